@@ -0,0 +1,69 @@
+#!/bin/bash
+#
+# Compare two benchmark files written by helpers/benchmark.sh and flag any
+# system that got slower or bigger by more than a threshold.
+#
+# Usage: helpers/benchcompare.sh old.tsv new.tsv [threshold_percent]
+#
+# The threshold defaults to 5 percent. Exits with status 1 if any system
+# regressed, so this can gate a merge.
+#
+
+if [ ! -f "$1" ] || [ ! -f "$2" ]
+   then
+   echo "Please run this like $0 old.tsv new.tsv [threshold_percent]."
+   exit 1
+fi
+
+THRESHOLD=${3:-5}
+
+awk -F'\t' -v threshold=$THRESHOLD '
+   # skip the header lines
+   /^#/ { next }
+
+   # first file: remember the old numbers
+   FNR == NR {
+      speed[$1] = $5
+      rss[$1] = $7
+      status[$1] = $8
+      next
+   }
+
+   # second file: compare against them
+   {
+      if (!($1 in speed)) {
+         printf "%-14s new system, no baseline\n", $1
+         next
+      }
+      if ($8 != "ok" || status[$1] != "ok") {
+         if ($8 == "ok")
+            printf "%-14s status %s -> ok\n", $1, status[$1]
+         else if ($8 != status[$1]) {
+            printf "%-14s REGRESSION: status %s -> %s\n", $1, status[$1], $8
+            regressions++
+         }
+         next
+      }
+
+      speed_delta = 100.0 * ($5 - speed[$1]) / speed[$1]
+      rss_delta = (rss[$1] > 0 && $7 > 0) ? 100.0 * ($7 - rss[$1]) / rss[$1] : 0
+      flag = ""
+      if (speed_delta < -threshold)
+         flag = flag " speed"
+      if (rss_delta > threshold)
+         flag = flag " rss"
+
+      printf "%-14s speed %8.2f%% -> %8.2f%% (%+6.1f%%)  rss %8d -> %8d KB (%+6.1f%%)%s\n", \
+         $1, speed[$1], $5, speed_delta, rss[$1], $7, rss_delta, (flag != "") ? "  REGRESSION:" flag : ""
+      if (flag != "")
+         regressions++
+   }
+
+   END {
+      if (regressions > 0) {
+         printf "%d system(s) regressed by more than %s%%\n", regressions, threshold
+         exit 1
+      }
+      print "No regressions above " threshold "%"
+   }
+' "$1" "$2"
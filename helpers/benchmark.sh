@@ -0,0 +1,98 @@
+#!/bin/bash
+#
+# Build every JSMESS system natively (NATIVE_DEBUG) and time how fast each one
+# runs, so upstream merges that slow a system down get noticed.
+#
+# Usage: helpers/benchmark.sh [output.tsv]
+#
+# Environment variables:
+#   SYSTEMS       - space separated list of make/systems/*.mak names to run
+#                   (default: all of them)
+#   BENCH_SECONDS - emulated seconds to run each system for (default: 30)
+#   BIOS_DIR      - where the BIOS zips live (default: bios)
+#
+# Must be run from the JSMESS root directory. The output is a tab separated
+# file with one line per system; compare two of them with
+# helpers/benchcompare.sh.
+#
+
+OUT=${1:-benchmark.tsv}
+BENCH_SECONDS=${BENCH_SECONDS:-30}
+BIOS_DIR=${BIOS_DIR:-bios}
+
+if [ ! -d make/systems ]
+   then
+   echo "Please run this from the JSMESS root directory."
+   exit 1
+fi
+
+if [ "$SYSTEMS" == "" ]
+   then
+   SYSTEMS=`ls make/systems/*.mak | sed 's/.*\///g' | sed 's/\.mak$//g'`
+fi
+
+# Polls the peak resident set size (in KB) of a process until it exits.
+# Linux only; reports 0 elsewhere.
+peak_rss() {
+   PEAK=0
+   while kill -0 $1 2>/dev/null
+      do
+      HWM=`grep VmHWM /proc/$1/status 2>/dev/null | awk '{print $2}'`
+      if [ "$HWM" != "" ] && [ "$HWM" -gt "$PEAK" ]
+         then
+         PEAK=$HWM
+      fi
+      sleep 0.1
+   done
+   echo $PEAK
+}
+
+echo -e "# system\tdriver\temu_seconds\treal_seconds\tspeed_pct\tns_per_frame\tpeak_rss_kb\tstatus" > $OUT
+
+for SYSTEM in $SYSTEMS
+   do
+   MAKEFILE=make/systems/$SYSTEM.mak
+   SUBTARGET=`grep "^SUBTARGET" $MAKEFILE | sed 's/.*:= *//g'`
+   DRIVER=`grep "^MESS_ARGS" $MAKEFILE | cut -f2 -d'"'`
+
+   echo "Building $SYSTEM ($SUBTARGET)..."
+   if ! make NATIVE_DEBUG=1 SYSTEM=$SYSTEM mess/mess$SUBTARGET > $SYSTEM.benchbuild.log 2>&1
+      then
+      echo "Build of $SYSTEM failed; see $SYSTEM.benchbuild.log"
+      echo -e "$SYSTEM\t$DRIVER\t0\t0\t0\t0\t0\tbuild_failed" >> $OUT
+      continue
+   fi
+   rm -f $SYSTEM.benchbuild.log
+
+   # 64-bit native builds get a '64' suffix from the MESS makefile
+   EXE=mess/mess$SUBTARGET
+   if [ ! -x $EXE ]
+      then
+      EXE=mess/mess${SUBTARGET}64
+   fi
+
+   echo "Running $DRIVER for $BENCH_SECONDS emulated seconds..."
+   $EXE $DRIVER -rompath $BIOS_DIR -bench $BENCH_SECONDS > $SYSTEM.bench.log 2>&1 &
+   PID=$!
+   RSS=`peak_rss $PID`
+   wait $PID
+   RESULT=$?
+
+   EMUSECS=`grep "^Benchmark:" $SYSTEM.bench.log | sed 's/.*, \([0-9.]*\) emulated seconds.*/\1/'`
+   REALSECS=`grep "^Benchmark:" $SYSTEM.bench.log | sed 's/.* in \([0-9.]*\) real seconds.*/\1/'`
+   SPEED=`grep "^Emulated speed:" $SYSTEM.bench.log | sed 's/[^0-9.]//g'`
+   NSFRAME=`grep "^Host time per frame:" $SYSTEM.bench.log | sed 's/[^0-9]//g'`
+
+   if [ $RESULT -ne 0 ] || [ "$SPEED" == "" ]
+      then
+      echo "Run of $SYSTEM failed; see $SYSTEM.bench.log"
+      echo -e "$SYSTEM\t$DRIVER\t0\t0\t0\t0\t$RSS\trun_failed" >> $OUT
+      continue
+   fi
+   rm -f $SYSTEM.bench.log
+
+   echo "$SYSTEM: $SPEED% speed, $NSFRAME ns/frame, $RSS KB peak RSS"
+   echo -e "$SYSTEM\t$DRIVER\t$EMUSECS\t$REALSECS\t$SPEED\t$NSFRAME\t$RSS\tok" >> $OUT
+done
+
+echo "Results written to $OUT"
@@ -0,0 +1,106 @@
+#!/bin/bash
+#
+# Build one MESS subtarget at two git revisions and time them against each
+# other with -bench, alternating the runs so host noise hits both builds.
+# Used to measure a single change; helpers/benchmark.sh covers all systems.
+#
+# Usage: helpers/benchpair.sh subtarget old_rev new_rev driver [mess args...]
+#
+# Environment variables:
+#   BENCH_DIR     - where the two trees are exported and built
+#                   (default: benchpair)
+#   BENCH_RUNS    - runs of each build (default: 5)
+#   BENCH_SECONDS - emulated seconds per run (default: 30)
+#
+# Must be run from the JSMESS root directory. Builds are native osdmini at
+# -O2. The -fno-* flags stop modern GCC from breaking old MAME code that
+# checks this == NULL, type puns, or relies on global_alloc_clear zeroing a
+# driver state before its constructor runs. Prints the host time per frame
+# of every run, then the medians and the change from old to new.
+#
+
+if [ ! -d make/systems ]
+   then
+   echo "Please run this from the JSMESS root directory."
+   exit 1
+fi
+
+if [ $# -lt 4 ]
+   then
+   echo "Please run this like $0 subtarget old_rev new_rev driver [mess args...]."
+   exit 1
+fi
+
+SUBTARGET=$1
+OLD_REV=$2
+NEW_REV=$3
+shift 3
+
+BENCH_DIR=${BENCH_DIR:-benchpair}
+BENCH_RUNS=${BENCH_RUNS:-5}
+BENCH_SECONDS=${BENCH_SECONDS:-30}
+JOBS=`getconf _NPROCESSORS_ONLN 2>/dev/null || echo 1`
+
+# Exports and builds one revision; sets EXE to the binary.
+build_rev() {
+   REV=`git rev-parse --short "$1"` || exit 1
+   TREE=$BENCH_DIR/$REV
+   if [ ! -d $TREE/mess ]
+      then
+      echo "Exporting $1 ($REV) to $TREE..."
+      mkdir -p $TREE
+      git archive $REV mess | tar -x -C $TREE || exit 1
+   fi
+
+   echo "Building $SUBTARGET at $REV..."
+   if ! make -C $TREE/mess TARGET=mess SUBTARGET=$SUBTARGET OSD=osdmini NOWERROR=1 LD=g++ OPTIMIZE=2 \
+         ARCHOPTS="-fno-delete-null-pointer-checks -fno-strict-aliasing -fno-lifetime-dse" -j$JOBS > $TREE/build.log 2>&1
+      then
+      echo "Build of $REV failed; see $TREE/build.log"
+      exit 1
+   fi
+
+   # 64-bit native builds get a '64' suffix from the MESS makefile
+   EXE=$TREE/mess/mess$SUBTARGET
+   if [ ! -x $EXE ]
+      then
+      EXE=$TREE/mess/mess${SUBTARGET}64
+   fi
+}
+
+build_rev $OLD_REV
+OLD_EXE=$EXE
+build_rev $NEW_REV
+NEW_EXE=$EXE
+
+# Runs one binary once and prints its host ns per frame.
+run_once() {
+   LOG=$BENCH_DIR/run.log
+   if ! "$@" -bench $BENCH_SECONDS > $LOG 2>&1
+      then
+      echo "Run of $1 failed; see $LOG" >&2
+      exit 1
+   fi
+   grep "^Host time per frame:" $LOG | sed 's/[^0-9]//g'
+}
+
+OLD_TIMES=""
+NEW_TIMES=""
+for RUN in `seq 1 $BENCH_RUNS`
+   do
+   OLD_NS=`run_once $OLD_EXE "$@"` || exit 1
+   NEW_NS=`run_once $NEW_EXE "$@"` || exit 1
+   echo "run $RUN: $OLD_REV $OLD_NS ns/frame, $NEW_REV $NEW_NS ns/frame"
+   OLD_TIMES="$OLD_TIMES $OLD_NS"
+   NEW_TIMES="$NEW_TIMES $NEW_NS"
+done
+
+median() {
+   echo $* | tr ' ' '\n' | sort -n | awk '{ v[NR] = $1 } END { print (NR % 2) ? v[(NR + 1) / 2] : (v[NR / 2] + v[NR / 2 + 1]) / 2 }'
+}
+
+OLD_MEDIAN=`median $OLD_TIMES`
+NEW_MEDIAN=`median $NEW_TIMES`
+awk -v o=$OLD_MEDIAN -v n=$NEW_MEDIAN -v or=$OLD_REV -v nr=$NEW_REV 'BEGIN {
+   printf "median: %s %d ns/frame, %s %d ns/frame (%+.1f%%)\n", or, o, nr, n, 100.0 * (n - o) / o
+}'
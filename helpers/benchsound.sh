@@ -0,0 +1,57 @@
+#!/bin/bash
+#
+# Sound mixing benchmark: runs the msx driver, whose mono speaker mixes seven
+# streams (DAC, cassette, three AY8910 channels, K051649 and YM2413), on a
+# stub BIOS that keeps the AY8910 playing tones. The AY8910 stream runs at
+# 224 kHz, so the resampler is busy too. Compares two revisions with
+# helpers/benchpair.sh.
+#
+# Usage: helpers/benchsound.sh old_rev new_rev
+#
+# The environment variables of helpers/benchpair.sh apply. The stub BIOS is
+# written to $BENCH_DIR/soundroms; no real MSX ROMs are needed.
+#
+
+if [ ! -d make/systems ]
+   then
+   echo "Please run this from the JSMESS root directory."
+   exit 1
+fi
+
+if [ $# -ne 2 ]
+   then
+   echo "Please run this like $0 old_rev new_rev."
+   exit 1
+fi
+
+BENCH_DIR=${BENCH_DIR:-benchpair}
+ROMS=$BENCH_DIR/soundroms
+
+# Writes hex bytes into a file at a byte offset: poke file offset bytes...
+poke() {
+   FILE=$1
+   OFFSET=$2
+   shift 2
+   printf "`printf '\\\\x%s' $*`" | dd of="$FILE" bs=1 seek=$((OFFSET)) conv=notrunc 2>/dev/null
+}
+
+mkdir -p $ROMS/msx
+
+# BIOS at $0000: tones on all three AY8910 channels at full volume, then
+# sweep channel A's pitch forever.
+BIOS=$ROMS/msx/msx.rom
+head -c 32768 /dev/zero > $BIOS
+poke $BIOS 0x00 f3                             # di
+OFFSET=1
+for REG_VALUE in 00:40 01:00 02:55 03:00 04:6a 05:00 07:b8 08:0f 09:0f 0a:0f
+   do
+   REG=${REG_VALUE%:*}
+   VALUE=${REG_VALUE#*:}
+   # ld a,reg / out ($a0),a / ld a,value / out ($a1),a
+   poke $BIOS $OFFSET 3e $REG d3 a0 3e $VALUE d3 a1
+   OFFSET=$((OFFSET + 8))
+done
+poke $BIOS $OFFSET 3e 00 d3 a0                 # select channel A fine pitch
+poke $BIOS $((OFFSET + 4)) 04 78 d3 a1 18 fa   # inc b / ld a,b / out ($a1),a / jr back
+
+BENCH_DIR=$BENCH_DIR helpers/benchpair.sh msx $1 $2 msx -rompath $ROMS
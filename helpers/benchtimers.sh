@@ -0,0 +1,78 @@
+#!/bin/bash
+#
+# Timer scheduling benchmark: runs the c64 driver on a stub kernal that keeps
+# a raster interrupt and three CIA timers firing, so most of the host time
+# goes to adjusting and firing device timers. Compares two revisions with
+# helpers/benchpair.sh.
+#
+# Usage: helpers/benchtimers.sh old_rev new_rev
+#
+# The environment variables of helpers/benchpair.sh apply. The stub ROMs are
+# written to $BENCH_DIR/timerroms; no real C64 ROMs are needed.
+#
+
+if [ ! -d make/systems ]
+   then
+   echo "Please run this from the JSMESS root directory."
+   exit 1
+fi
+
+if [ $# -ne 2 ]
+   then
+   echo "Please run this like $0 old_rev new_rev."
+   exit 1
+fi
+
+BENCH_DIR=${BENCH_DIR:-benchpair}
+ROMS=$BENCH_DIR/timerroms
+
+# Writes hex bytes into a file at a byte offset: poke file offset bytes...
+poke() {
+   FILE=$1
+   OFFSET=$2
+   shift 2
+   printf "`printf '\\\\x%s' $*`" | dd of="$FILE" bs=1 seek=$((OFFSET)) conv=notrunc 2>/dev/null
+}
+
+# Creates a file of $2 bytes filled with 6502 NOPs.
+nops() {
+   head -c $2 /dev/zero | tr '\0' '\352' > "$1"
+}
+
+mkdir -p $ROMS/c64 $ROMS/c1541
+
+# Kernal at $E000: set up the raster IRQ, CIA1 timers A and B (IRQ) and
+# CIA2 timer A (NMI) in continuous mode, then spin on the border colour.
+KERNAL=$ROMS/c64/901227-03.bin
+nops $KERNAL 8192
+poke $KERNAL 0x00 78 a2 ff 9a                  # sei / ldx #$ff / txs
+poke $KERNAL 0x04 a9 2f 85 00 a9 37 85 01      # cpu port: kernal, i/o, basic
+poke $KERNAL 0x0c a9 1b 8d 11 d0               # screen on
+poke $KERNAL 0x11 a9 80 8d 12 d0               # raster compare line $80
+poke $KERNAL 0x16 a9 01 8d 1a d0               # raster irq on
+poke $KERNAL 0x1b a9 80 8d 04 dc a9 00 8d 05 dc # cia1 timer a = 128
+poke $KERNAL 0x25 a9 c8 8d 06 dc a9 00 8d 07 dc # cia1 timer b = 200
+poke $KERNAL 0x2f a9 83 8d 0d dc               # cia1 irq on a and b
+poke $KERNAL 0x34 a9 11 8d 0e dc 8d 0f dc      # start both, continuous
+poke $KERNAL 0x3c a9 00 8d 04 dd a9 01 8d 05 dd # cia2 timer a = 256
+poke $KERNAL 0x46 a9 81 8d 0d dd               # cia2 nmi on a
+poke $KERNAL 0x4b a9 11 8d 0e dd               # start, continuous
+poke $KERNAL 0x50 58                           # cli
+poke $KERNAL 0x51 ee 20 d0 4c 51 e0            # inc $d020 / jmp back to it
+poke $KERNAL 0x80 48 ad 0d dc a9 0f 8d 19 d0 68 40 # irq: ack cia1 and vic
+poke $KERNAL 0x90 48 ad 0d dd 68 40            # nmi: ack cia2
+poke $KERNAL 0x1ffa 90 e0 00 e0 80 e0          # nmi, reset, irq vectors
+
+head -c 8192 /dev/zero > $ROMS/c64/901226-01.bin
+head -c 4096 /dev/zero > $ROMS/c64/901225-01.bin
+
+# 1541 drive: a jump to itself, with rti for its interrupts
+DOS="$ROMS/c1541/901229-06 aa.uab5"
+nops "$DOS" 8192
+poke "$DOS" 0x00 4c 00 e0
+poke "$DOS" 0x100 40
+poke "$DOS" 0x1ffa 00 e1 00 e0 00 e1
+nops $ROMS/c1541/325302-01.uab4 8192
+cp $ROMS/c1541/* $ROMS/c64/
+
+BENCH_DIR=$BENCH_DIR helpers/benchpair.sh c64 $1 $2 c64 -rompath $ROMS
@@ -0,0 +1,16 @@
+#include "emu.h"
+
+GAME_EXTERN(___empty);
+GAME_EXTERN(coleco);
+GAME_EXTERN(colecoa);
+GAME_EXTERN(colecob);
+
+const game_driver * const driver_list::s_drivers_sorted[4] =
+{
+	&GAME_NAME(___empty),
+	&GAME_NAME(coleco),
+	&GAME_NAME(colecoa),
+	&GAME_NAME(colecob)
+};
+
+int driver_list::s_driver_count = 4;
@@ -0,0 +1,14 @@
+#include "emu.h"
+
+GAME_EXTERN(___empty);
+GAME_EXTERN(a400);
+GAME_EXTERN(a800);
+
+const game_driver * const driver_list::s_drivers_sorted[3] =
+{
+	&GAME_NAME(___empty),
+	&GAME_NAME(a400),
+	&GAME_NAME(a800)
+};
+
+int driver_list::s_driver_count = 3;
@@ -0,0 +1,18 @@
+#include "emu.h"
+
+GAME_EXTERN(___empty);
+GAME_EXTERN(gameboy);
+GAME_EXTERN(gbcolor);
+GAME_EXTERN(gblight);
+GAME_EXTERN(gbpocket);
+
+const game_driver * const driver_list::s_drivers_sorted[5] =
+{
+	&GAME_NAME(___empty),
+	&GAME_NAME(gameboy),
+	&GAME_NAME(gbcolor),
+	&GAME_NAME(gblight),
+	&GAME_NAME(gbpocket)
+};
+
+int driver_list::s_driver_count = 5;
@@ -0,0 +1,18 @@
+#include "emu.h"
+
+GAME_EXTERN(___empty);
+GAME_EXTERN(genesis);
+GAME_EXTERN(gensvp);
+GAME_EXTERN(megadrij);
+GAME_EXTERN(megadriv);
+
+const game_driver * const driver_list::s_drivers_sorted[5] =
+{
+	&GAME_NAME(___empty),
+	&GAME_NAME(genesis),
+	&GAME_NAME(gensvp),
+	&GAME_NAME(megadrij),
+	&GAME_NAME(megadriv)
+};
+
+int driver_list::s_driver_count = 5;
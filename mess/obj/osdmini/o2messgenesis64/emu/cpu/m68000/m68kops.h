@@ -0,0 +1,25 @@
+#ifndef M68KOPS__HEADER
+#define M68KOPS__HEADER
+
+/* ======================================================================== */
+/* ============================ OPCODE HANDLERS =========================== */
+/* ======================================================================== */
+
+
+/* Build the opcode handler table */
+void m68ki_build_opcode_table(void);
+
+/* The jump table holds an index into m68ki_instruction_handlers rather than
+   the handler itself, which keeps it a quarter of the size on 64-bit hosts */
+extern unsigned short m68ki_instruction_jump_table[0x10000]; /* opcode handler jump table */
+extern void (*m68ki_instruction_handlers[])(m68ki_cpu_core *m68k); /* one per opcode handler table entry */
+extern unsigned char m68ki_cycles[][0x10000];
+
+
+/* ======================================================================== */
+/* ============================== END OF FILE ============================= */
+/* ======================================================================== */
+
+#endif /* M68KOPS__HEADER */
+
+
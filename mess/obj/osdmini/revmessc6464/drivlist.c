@@ -0,0 +1,12 @@
+#include "emu.h"
+
+GAME_EXTERN(___empty);
+GAME_EXTERN(c64);
+
+const game_driver * const driver_list::s_drivers_sorted[2] =
+{
+	&GAME_NAME(___empty),
+	&GAME_NAME(c64)
+};
+
+int driver_list::s_driver_count = 2;
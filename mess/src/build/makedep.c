@@ -349,7 +349,7 @@ static int recurse_dir(int srcrootlen, const astring *srcdir)
 					tagmap_entry *entry;
 					file_entry *file;
 					astring *target;
-					int taghash;
+					UINT32 taghash;
 
 					/* find dependencies */
 					file = compute_dependencies(srcrootlen, srcfile);
@@ -362,7 +362,7 @@ static int recurse_dir(int srcrootlen, const astring *srcdir)
 					printf("\n%s : \\\n", astring_c(target));
 
 					/* iterate over the hashed dependencies and output them as well */
-					for (taghash = 0; taghash < TAGMAP_HASH_SIZE; taghash++)
+					for (taghash = 0; taghash < depend_map->size; taghash++)
 						for (entry = depend_map->table[taghash]; entry != NULL; entry = entry->next)
 							printf("\t%s \\\n", astring_c((astring *)entry->object));
 
@@ -1065,20 +1065,28 @@ DASMOBJS += $(CPUOBJ)/m68000/m68kdasm.o
 M68KMAKE = $(BUILDOUT)/m68kmake$(BUILD_EXE)
 endif
 
+# a subtarget whose drivers only use one 68k family member can set
+# M68K_SINGLE_CPU to 000, 010, 020, 030 or 040 to generate and build
+# only that CPU's opcode handlers and cycle table
+ifneq ($(M68K_SINGLE_CPU),)
+M68KMAKE_OPTS = -cpu $(M68K_SINGLE_CPU)
+M68KDEFS = -DM68K_SINGLE_CPU_$(M68K_SINGLE_CPU)
+endif
+
 # when we compile source files we need to include generated files from the OBJ directory
 $(CPUOBJ)/m68000/%.o: $(CPUSRC)/m68000/%.c | $(OSPREBUILD)
 	@echo Compiling $<...
-	$(CC) $(CDEFS) $(CFLAGS) -I$(CPUOBJ)/m68000 -c $< -o $@
+	$(CC) $(CDEFS) $(M68KDEFS) $(CFLAGS) -I$(CPUOBJ)/m68000 -c $< -o $@
 
 # when we compile generated files we need to include stuff from the src directory
 $(CPUOBJ)/m68000/%.o: $(CPUOBJ)/m68000/%.c | $(OSPREBUILD)
 	@echo Compiling $<...
-	$(CC) $(CDEFS) $(CFLAGS) -I$(CPUSRC)/m68000 -c $< -o $@
+	$(CC) $(CDEFS) $(M68KDEFS) $(CFLAGS) -I$(CPUSRC)/m68000 -c $< -o $@
 
 # rule to generate the C files
 $(CPUOBJ)/m68000/m68kops.c: $(M68KMAKE) $(CPUSRC)/m68000/m68k_in.c
 	@echo Generating M68K source files...
-	$(M68KMAKE) $(CPUOBJ)/m68000 $(CPUSRC)/m68000/m68k_in.c
+	$(M68KMAKE) $(M68KMAKE_OPTS) $(CPUOBJ)/m68000 $(CPUSRC)/m68000/m68k_in.c
 
 # rule to build the generator
 ifneq ($(CROSS_BUILD),1)
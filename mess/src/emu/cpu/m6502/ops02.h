@@ -65,7 +65,7 @@
 #define PPC cpustate->ppc.d
 
 #define RDMEM_ID(a)		cpustate->rdmem_id(cpustate->space,a)
-#define WRMEM_ID(a,d)	cpustate->wrmem_id(cpustate->space,a,d)
+#define WRMEM_ID(a,d)	cpustate->wrmem_id(cpustate->space,a,d); cpustate->device->idle_write(a,d)
 
 /***************************************************************
  *  RDOP    read an opcode
@@ -86,7 +86,13 @@
 /***************************************************************
  *  WRMEM   write memory
  ***************************************************************/
-#define WRMEM(addr,data) cpustate->space->write_byte(addr,data); cpustate->icount -= 1
+#define WRMEM(addr,data) cpustate->space->write_byte(addr,data); cpustate->device->idle_write(addr,data); cpustate->icount -= 1
+
+/***************************************************************
+ *  IDLE_BRANCH report a taken backward branch and the registers
+ *  so loops that only wait for an interrupt can be skipped
+ ***************************************************************/
+#define IDLE_BRANCH cpustate->device->idle_branch(PPC, A | (X << 8) | (Y << 16) | ((UINT64)P << 24) | ((UINT64)S << 32))
 
 /***************************************************************
  *  BRA  branch relative
@@ -102,6 +108,8 @@
 			if ( EAH != PCH ) {										\
 				RDMEM( (PCH << 8 ) | EAL) ;							\
 			}														\
+			if ( tmp2 < 0 )											\
+				IDLE_BRANCH;										\
 			PCD = EAD;												\
 		}															\
 	}
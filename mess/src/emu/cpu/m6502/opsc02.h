@@ -149,6 +149,8 @@
 		if ( EAH != PCH ) {										\
 			RDMEM( PCW - 1 );									\
 		}														\
+		if ( (signed char)tmp < 0 )								\
+			IDLE_BRANCH;										\
 		PCD = EAD;												\
 	}
 
@@ -104,7 +104,10 @@ M68KMAKE_PROTOTYPE_FOOTER
 /* Build the opcode handler table */
 void m68ki_build_opcode_table(void);
 
-extern void (*m68ki_instruction_jump_table[0x10000])(m68ki_cpu_core *m68k); /* opcode handler jump table */
+/* The jump table holds an index into m68ki_instruction_handlers rather than
+   the handler itself, which keeps it a quarter of the size on 64-bit hosts */
+extern unsigned short m68ki_instruction_jump_table[0x10000]; /* opcode handler jump table */
+extern void (*m68ki_instruction_handlers[])(m68ki_cpu_core *m68k); /* one per opcode handler table entry */
 extern unsigned char m68ki_cycles[][0x10000];
 
 
@@ -125,9 +128,14 @@ M68KMAKE_TABLE_HEADER
 
 #include "m68kops.h"
 
+/* single-CPU builds (see m68kcpu.h) only carry that CPU's cycles */
+#if M68K_SINGLE_CPU
+#define NUM_CPU_TYPES 1
+#else
 #define NUM_CPU_TYPES 5
+#endif
 
-void  (*m68ki_instruction_jump_table[0x10000])(m68ki_cpu_core *m68k); /* opcode handler jump table */
+unsigned short m68ki_instruction_jump_table[0x10000]; /* opcode handler jump table */
 unsigned char m68ki_cycles[NUM_CPU_TYPES][0x10000]; /* Cycles used by CPU type */
 
 /* This is used to generate the opcode handler jump table */
@@ -150,9 +158,13 @@ static const opcode_handler_struct m68k_opcode_handler_table[] =
 XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 M68KMAKE_TABLE_FOOTER
 
-	{0, 0, 0, {0, 0, 0, 0, 0}}
+	{0, 0, 0, {0}}
 };
 
+/* Entry 0 is the illegal instruction, then one per line of the table above */
+void (*m68ki_instruction_handlers[ARRAY_LENGTH(m68k_opcode_handler_table)])(m68ki_cpu_core *m68k);
+#define HANDLER_INDEX(ostruct) ((ostruct) - m68k_opcode_handler_table + 1)
+
 
 /* Build the opcode handler jump table */
 void m68ki_build_opcode_table(void)
@@ -163,10 +175,14 @@ void m68ki_build_opcode_table(void)
 	int j;
 	int k;
 
+	m68ki_instruction_handlers[0] = m68k_op_illegal;
+	for(i = 0; m68k_opcode_handler_table[i].mask != 0; i++)
+		m68ki_instruction_handlers[i + 1] = m68k_opcode_handler_table[i].opcode_handler;
+
 	for(i = 0; i < 0x10000; i++)
 	{
 		/* default to illegal */
-		m68ki_instruction_jump_table[i] = m68k_op_illegal;
+		m68ki_instruction_jump_table[i] = 0;
 		for(k=0;k<NUM_CPU_TYPES;k++)
 			m68ki_cycles[k][i] = 0;
 	}
@@ -178,7 +194,7 @@ void m68ki_build_opcode_table(void)
 		{
 			if((i & ostruct->mask) == ostruct->match)
 			{
-				m68ki_instruction_jump_table[i] = ostruct->opcode_handler;
+				m68ki_instruction_jump_table[i] = HANDLER_INDEX(ostruct);
 				for(k=0;k<NUM_CPU_TYPES;k++)
 					m68ki_cycles[k][i] = ostruct->cycles[k];
 			}
@@ -189,7 +205,7 @@ void m68ki_build_opcode_table(void)
 	{
 		for(i = 0;i <= 0xff;i++)
 		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
+			m68ki_instruction_jump_table[ostruct->match | i] = HANDLER_INDEX(ostruct);
 			for(k=0;k<NUM_CPU_TYPES;k++)
 				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
 		}
@@ -202,7 +218,7 @@ void m68ki_build_opcode_table(void)
 			for(j = 0;j < 8;j++)
 			{
 				instr = ostruct->match | (i << 9) | j;
-				m68ki_instruction_jump_table[instr] = ostruct->opcode_handler;
+				m68ki_instruction_jump_table[instr] = HANDLER_INDEX(ostruct);
 				for(k=0;k<NUM_CPU_TYPES;k++)
 					m68ki_cycles[k][instr] = ostruct->cycles[k];
 			}
@@ -213,7 +229,7 @@ void m68ki_build_opcode_table(void)
 	{
 		for(i = 0;i <= 0x0f;i++)
 		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
+			m68ki_instruction_jump_table[ostruct->match | i] = HANDLER_INDEX(ostruct);
 			for(k=0;k<NUM_CPU_TYPES;k++)
 				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
 		}
@@ -223,7 +239,7 @@ void m68ki_build_opcode_table(void)
 	{
 		for(i = 0;i <= 0x07;i++)
 		{
-			m68ki_instruction_jump_table[ostruct->match | (i << 9)] = ostruct->opcode_handler;
+			m68ki_instruction_jump_table[ostruct->match | (i << 9)] = HANDLER_INDEX(ostruct);
 			for(k=0;k<NUM_CPU_TYPES;k++)
 				m68ki_cycles[k][ostruct->match | (i << 9)] = ostruct->cycles[k];
 		}
@@ -233,7 +249,7 @@ void m68ki_build_opcode_table(void)
 	{
 		for(i = 0;i <= 0x07;i++)
 		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
+			m68ki_instruction_jump_table[ostruct->match | i] = HANDLER_INDEX(ostruct);
 			for(k=0;k<NUM_CPU_TYPES;k++)
 				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
 		}
@@ -241,7 +257,7 @@ void m68ki_build_opcode_table(void)
 	}
 	while(ostruct->mask == 0xffff)
 	{
-		m68ki_instruction_jump_table[ostruct->match] = ostruct->opcode_handler;
+		m68ki_instruction_jump_table[ostruct->match] = HANDLER_INDEX(ostruct);
 		for(k=0;k<NUM_CPU_TYPES;k++)
 			m68ki_cycles[k][ostruct->match] = ostruct->cycles[k];
 		ostruct++;
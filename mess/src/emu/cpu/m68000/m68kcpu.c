@@ -496,6 +496,7 @@ const UINT8 m68ki_ea_idx_cycle_table[64] =
 INLINE m68ki_cpu_core *get_safe_token(device_t *device)
 {
 	assert(device != NULL);
+#if !M68K_SINGLE_CPU
 	assert(device->type() == M68000 ||
 		   device->type() == M68008 ||
 		   device->type() == M68010 ||
@@ -508,9 +509,17 @@ INLINE m68ki_cpu_core *get_safe_token(device_t *device)
 		   device->type() == M68EC040 ||
 		   device->type() == M68040 ||
 		   device->type() == SCC68070);
+#endif
 	return (m68ki_cpu_core *)downcast<legacy_cpu_device *>(device)->token();
 }
 
+/* Single-CPU builds only generate the cycle table for the CPU they were built
+   for, and only define that CPU's device types, so nothing else gets here */
+INLINE const UINT8 *cycle_table(int index)
+{
+	return m68ki_cycles[M68K_SINGLE_CPU ? 0 : index];
+}
+
 /* ======================================================================== */
 /* ================================= API ================================== */
 /* ======================================================================== */
@@ -638,11 +647,11 @@ static CPU_EXECUTE( m68k )
 			/* Record previous program counter */
 			REG_PPC = REG_PC;
 
-			if (!m68k->pmmu_enabled)
+			if (!M68K_HAS_PMMU || !m68k->pmmu_enabled)
 			{
 				/* Read an instruction and call its handler */
 				m68k->ir = m68ki_read_imm_16(m68k);
-				m68ki_instruction_jump_table[m68k->ir](m68k);
+				m68ki_instruction_handlers[m68ki_instruction_jump_table[m68k->ir]](m68k);
 				m68k->remaining_cycles -= m68k->cyc_instruction[m68k->ir];
 			}
 			else
@@ -663,7 +672,7 @@ static CPU_EXECUTE( m68k )
 
 				if (!m68k->mmu_tmp_buserror_occurred)
 				{
-					m68ki_instruction_jump_table[m68k->ir](m68k);
+					m68ki_instruction_handlers[m68ki_instruction_jump_table[m68k->ir]](m68k);
 					m68k->remaining_cycles -= m68k->cyc_instruction[m68k->ir];
 				}
 
@@ -1574,6 +1583,7 @@ static void define_state(device_t *device)
 }
 
 
+#if M68K_CPU_TYPES & CPU_TYPE_000
 /****************************************************************************
  * 68000 section
  ****************************************************************************/
@@ -1592,7 +1602,7 @@ static CPU_INIT( m68000 )
 	new(&m68k->memory) m68k_memory_interface;
 	m68k->memory.init16(*m68k->program);
 	m68k->sr_mask          = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	m68k->cyc_instruction  = m68ki_cycles[0];
+	m68k->cyc_instruction  = cycle_table(0);
 	m68k->cyc_exception    = m68ki_exception_cycle_table[0];
 	m68k->cyc_bcc_notake_b = -2;
 	m68k->cyc_bcc_notake_w = 2;
@@ -1643,7 +1653,7 @@ static CPU_INIT( m68008 )
 	new(&m68k->memory) m68k_memory_interface;
 	m68k->memory.init8(*m68k->program);
 	m68k->sr_mask          = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	m68k->cyc_instruction  = m68ki_cycles[0];
+	m68k->cyc_instruction  = cycle_table(0);
 	m68k->cyc_exception    = m68ki_exception_cycle_table[0];
 	m68k->cyc_bcc_notake_b = -2;
 	m68k->cyc_bcc_notake_w = 2;
@@ -1677,8 +1687,10 @@ CPU_GET_INFO( m68008 )
 		default:										CPU_GET_INFO_CALL(m68k);				break;
 	}
 }
+#endif
 
 
+#if M68K_CPU_TYPES & CPU_TYPE_010
 /****************************************************************************
  * M68010 section
  ****************************************************************************/
@@ -1697,7 +1709,7 @@ static CPU_INIT( m68010 )
 	new(&m68k->memory) m68k_memory_interface;
 	m68k->memory.init16(*m68k->program);
 	m68k->sr_mask          = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	m68k->cyc_instruction  = m68ki_cycles[1];
+	m68k->cyc_instruction  = cycle_table(1);
 	m68k->cyc_exception    = m68ki_exception_cycle_table[1];
 	m68k->cyc_bcc_notake_b = -4;
 	m68k->cyc_bcc_notake_w = 0;
@@ -1727,8 +1739,10 @@ CPU_GET_INFO( m68010 )
 		default:										CPU_GET_INFO_CALL(m68k);				break;
 	}
 }
+#endif
 
 
+#if M68K_CPU_TYPES & CPU_TYPE_020
 /****************************************************************************
  * M68020 section
  ****************************************************************************/
@@ -1747,7 +1761,7 @@ static CPU_INIT( m68020 )
 	new(&m68k->memory) m68k_memory_interface;
 	m68k->memory.init32(*m68k->program);
 	m68k->sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	m68k->cyc_instruction  = m68ki_cycles[2];
+	m68k->cyc_instruction  = cycle_table(2);
 	m68k->cyc_exception    = m68ki_exception_cycle_table[2];
 	m68k->cyc_bcc_notake_b = -2;
 	m68k->cyc_bcc_notake_w = 0;
@@ -1863,7 +1877,7 @@ static CPU_INIT( m68ec020 )
 	new(&m68k->memory) m68k_memory_interface;
 	m68k->memory.init32(*m68k->program);
 	m68k->sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	m68k->cyc_instruction  = m68ki_cycles[2];
+	m68k->cyc_instruction  = cycle_table(2);
 	m68k->cyc_exception    = m68ki_exception_cycle_table[2];
 	m68k->cyc_bcc_notake_b = -2;
 	m68k->cyc_bcc_notake_w = 0;
@@ -1896,7 +1910,9 @@ CPU_GET_INFO( m68ec020 )
 		default:										CPU_GET_INFO_CALL(m68020);				break;
 	}
 }
+#endif
 
+#if M68K_CPU_TYPES & CPU_TYPE_030
 /****************************************************************************
  * M68030 section
  ****************************************************************************/
@@ -1915,7 +1931,7 @@ static CPU_INIT( m68030 )
 	new(&m68k->memory) m68k_memory_interface;
 	m68k->memory.init32mmu(*m68k->program);
 	m68k->sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	m68k->cyc_instruction  = m68ki_cycles[3];
+	m68k->cyc_instruction  = cycle_table(3);
 	m68k->cyc_exception    = m68ki_exception_cycle_table[3];
 	m68k->cyc_bcc_notake_b = -2;
 	m68k->cyc_bcc_notake_w = 0;
@@ -1973,7 +1989,7 @@ static CPU_INIT( m68ec030 )
 	new(&m68k->memory) m68k_memory_interface;
 	m68k->memory.init32(*m68k->program);
 	m68k->sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	m68k->cyc_instruction  = m68ki_cycles[3];
+	m68k->cyc_instruction  = cycle_table(3);
 	m68k->cyc_exception    = m68ki_exception_cycle_table[3];
 	m68k->cyc_bcc_notake_b = -2;
 	m68k->cyc_bcc_notake_w = 0;
@@ -2003,7 +2019,9 @@ CPU_GET_INFO( m68ec030 )
 		default:										CPU_GET_INFO_CALL(m68030);				break;
 	}
 }
+#endif
 
+#if M68K_CPU_TYPES & CPU_TYPE_040
 /****************************************************************************
  * M68040 section
  ****************************************************************************/
@@ -2022,7 +2040,7 @@ static CPU_INIT( m68040 )
 	new(&m68k->memory) m68k_memory_interface;
 	m68k->memory.init32mmu(*m68k->program);
 	m68k->sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	m68k->cyc_instruction  = m68ki_cycles[4];
+	m68k->cyc_instruction  = cycle_table(4);
 	m68k->cyc_exception    = m68ki_exception_cycle_table[4];
 	m68k->cyc_bcc_notake_b = -2;
 	m68k->cyc_bcc_notake_w = 0;
@@ -2079,7 +2097,7 @@ static CPU_INIT( m68ec040 )
 	new(&m68k->memory) m68k_memory_interface;
 	m68k->memory.init32(*m68k->program);
 	m68k->sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	m68k->cyc_instruction  = m68ki_cycles[4];
+	m68k->cyc_instruction  = cycle_table(4);
 	m68k->cyc_exception    = m68ki_exception_cycle_table[4];
 	m68k->cyc_bcc_notake_b = -2;
 	m68k->cyc_bcc_notake_w = 0;
@@ -2128,7 +2146,7 @@ static CPU_INIT( m68lc040 )
 	new(&m68k->memory) m68k_memory_interface;
 	m68k->memory.init32(*m68k->program);
 	m68k->sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	m68k->cyc_instruction  = m68ki_cycles[4];
+	m68k->cyc_instruction  = cycle_table(4);
 	m68k->cyc_exception    = m68ki_exception_cycle_table[4];
 	m68k->cyc_bcc_notake_b = -2;
 	m68k->cyc_bcc_notake_w = 0;
@@ -2158,7 +2176,9 @@ CPU_GET_INFO( m68lc040 )
 		default:										CPU_GET_INFO_CALL(m68040);				break;
 	}
 }
+#endif
 
+#if M68K_CPU_TYPES & CPU_TYPE_SCC070
 /****************************************************************************
  * SCC-68070 section
  ****************************************************************************/
@@ -2188,18 +2208,33 @@ CPU_GET_INFO( scc68070 )
 		default:										CPU_GET_INFO_CALL(m68k);				break;
 	}
 }
+#endif
 
+/* a single-CPU build (see m68kcpu.h) only defines the device types it can
+   run, so a driver asking for any other one fails to link */
+#if M68K_CPU_TYPES & CPU_TYPE_000
 DEFINE_LEGACY_CPU_DEVICE(M68000, m68000);
 DEFINE_LEGACY_CPU_DEVICE(M68008, m68008);
+#endif
+#if M68K_CPU_TYPES & CPU_TYPE_010
 DEFINE_LEGACY_CPU_DEVICE(M68010, m68010);
+#endif
+#if M68K_CPU_TYPES & CPU_TYPE_020
 DEFINE_LEGACY_CPU_DEVICE(M68EC020, m68ec020);
 DEFINE_LEGACY_CPU_DEVICE(M68020, m68020);
 DEFINE_LEGACY_CPU_DEVICE(M68020PMMU, m68020pmmu);
 DEFINE_LEGACY_CPU_DEVICE(M68020HMMU, m68020hmmu);
+#endif
+#if M68K_CPU_TYPES & CPU_TYPE_030
 DEFINE_LEGACY_CPU_DEVICE(M68EC030, m68ec030);
 DEFINE_LEGACY_CPU_DEVICE(M68030, m68030);
+#endif
+#if M68K_CPU_TYPES & CPU_TYPE_040
 DEFINE_LEGACY_CPU_DEVICE(M68EC040, m68ec040);
 DEFINE_LEGACY_CPU_DEVICE(M68LC040, m68lc040);
 DEFINE_LEGACY_CPU_DEVICE(M68040, m68040);
+#endif
+#if M68K_CPU_TYPES & CPU_TYPE_SCC070
 DEFINE_LEGACY_CPU_DEVICE(SCC68070, scc68070);
+#endif
 
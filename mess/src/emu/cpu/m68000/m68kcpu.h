@@ -232,26 +232,54 @@ typedef struct _m68ki_cpu_core m68ki_cpu_core;
 
 /* These defines are dependant on the configuration defines in m68kconf.h */
 
+/* A single-CPU build (M68K_SINGLE_CPU = 000, 010, 020, 030 or 040 in the
+   makefile) passes -cpu to m68kmake and defines M68K_SINGLE_CPU_xxx here, so
+   only those CPU types exist and every test below folds to a constant */
+#if defined(M68K_SINGLE_CPU_000)
+#define M68K_CPU_TYPES             (CPU_TYPE_000 | CPU_TYPE_008)
+#elif defined(M68K_SINGLE_CPU_010)
+#define M68K_CPU_TYPES             (CPU_TYPE_010 | CPU_TYPE_SCC070)
+#elif defined(M68K_SINGLE_CPU_020)
+#define M68K_CPU_TYPES             (CPU_TYPE_EC020 | CPU_TYPE_020)
+#elif defined(M68K_SINGLE_CPU_030)
+#define M68K_CPU_TYPES             (CPU_TYPE_EC030 | CPU_TYPE_030)
+#elif defined(M68K_SINGLE_CPU_040)
+#define M68K_CPU_TYPES             (CPU_TYPE_EC040 | CPU_TYPE_LC040 | CPU_TYPE_040)
+#endif
+
+#ifdef M68K_CPU_TYPES
+#define M68K_SINGLE_CPU            1
+#else
+#define M68K_SINGLE_CPU            0
+#define M68K_CPU_TYPES             (~0)
+#endif
+
+/* Is A one of the types T?  Constant if all or none of the built types are */
+#define CPU_TYPE_IN(A, T)          (!(M68K_CPU_TYPES & (T)) ? 0 : !(M68K_CPU_TYPES & ~(T)) ? 1 : ((A) & (T)))
+
 /* Disable certain comparisons if we're not using all CPU types */
-#define CPU_TYPE_IS_040_PLUS(A)    ((A) & (CPU_TYPE_040 | CPU_TYPE_EC040))
+#define CPU_TYPE_IS_040_PLUS(A)    CPU_TYPE_IN(A, CPU_TYPE_040 | CPU_TYPE_EC040)
 #define CPU_TYPE_IS_040_LESS(A)    1
 
-#define CPU_TYPE_IS_030_PLUS(A)    ((A) & (CPU_TYPE_030 | CPU_TYPE_EC030 | CPU_TYPE_040 | CPU_TYPE_EC040))
+#define CPU_TYPE_IS_030_PLUS(A)    CPU_TYPE_IN(A, CPU_TYPE_030 | CPU_TYPE_EC030 | CPU_TYPE_040 | CPU_TYPE_EC040)
 #define CPU_TYPE_IS_030_LESS(A)    1
 
-#define CPU_TYPE_IS_020_PLUS(A)    ((A) & (CPU_TYPE_020 | CPU_TYPE_030 | CPU_TYPE_EC030 | CPU_TYPE_040 | CPU_TYPE_EC040))
+#define CPU_TYPE_IS_020_PLUS(A)    CPU_TYPE_IN(A, CPU_TYPE_020 | CPU_TYPE_030 | CPU_TYPE_EC030 | CPU_TYPE_040 | CPU_TYPE_EC040)
 #define CPU_TYPE_IS_020_LESS(A)    1
 
-#define CPU_TYPE_IS_020_VARIANT(A) ((A) & (CPU_TYPE_EC020 | CPU_TYPE_020))
+#define CPU_TYPE_IS_020_VARIANT(A) CPU_TYPE_IN(A, CPU_TYPE_EC020 | CPU_TYPE_020)
+
+#define CPU_TYPE_IS_EC020_PLUS(A)  CPU_TYPE_IN(A, CPU_TYPE_EC020 | CPU_TYPE_020 | CPU_TYPE_030 | CPU_TYPE_EC030 | CPU_TYPE_040 | CPU_TYPE_EC040)
+#define CPU_TYPE_IS_EC020_LESS(A)  CPU_TYPE_IN(A, CPU_TYPE_000 | CPU_TYPE_008 | CPU_TYPE_010 | CPU_TYPE_EC020)
 
-#define CPU_TYPE_IS_EC020_PLUS(A)  ((A) & (CPU_TYPE_EC020 | CPU_TYPE_020 | CPU_TYPE_030 | CPU_TYPE_EC030 | CPU_TYPE_040 | CPU_TYPE_EC040))
-#define CPU_TYPE_IS_EC020_LESS(A)  ((A) & (CPU_TYPE_000 | CPU_TYPE_008 | CPU_TYPE_010 | CPU_TYPE_EC020))
+#define CPU_TYPE_IS_010(A)         CPU_TYPE_IN(A, CPU_TYPE_010)
+#define CPU_TYPE_IS_010_PLUS(A)    CPU_TYPE_IN(A, CPU_TYPE_010 | CPU_TYPE_EC020 | CPU_TYPE_020 | CPU_TYPE_EC030 | CPU_TYPE_030 | CPU_TYPE_040 | CPU_TYPE_EC040)
+#define CPU_TYPE_IS_010_LESS(A)    CPU_TYPE_IN(A, CPU_TYPE_000 | CPU_TYPE_008 | CPU_TYPE_010)
 
-#define CPU_TYPE_IS_010(A)         ((A) == CPU_TYPE_010)
-#define CPU_TYPE_IS_010_PLUS(A)    ((A) & (CPU_TYPE_010 | CPU_TYPE_EC020 | CPU_TYPE_020 | CPU_TYPE_EC030 | CPU_TYPE_030 | CPU_TYPE_040 | CPU_TYPE_EC040))
-#define CPU_TYPE_IS_010_LESS(A)    ((A) & (CPU_TYPE_000 | CPU_TYPE_008 | CPU_TYPE_010))
+#define CPU_TYPE_IS_000(A)         CPU_TYPE_IN(A, CPU_TYPE_000 | CPU_TYPE_008)
 
-#define CPU_TYPE_IS_000(A)         ((A) == CPU_TYPE_000 || (A) == CPU_TYPE_008)
+/* Only the 68020 and up can have a paged MMU */
+#define M68K_HAS_PMMU              ((M68K_CPU_TYPES & (CPU_TYPE_020 | CPU_TYPE_EC030 | CPU_TYPE_030 | CPU_TYPE_EC040 | CPU_TYPE_LC040 | CPU_TYPE_040)) != 0)
 
 
 /* Configuration switches (see m68kconf.h for explanation) */
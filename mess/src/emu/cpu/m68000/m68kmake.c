@@ -39,11 +39,17 @@
  * It requires an input file to function (default m68k_in.c), but you can
  * specify your own like so:
  *
- * m68kmake <output path> <input file>
+ * m68kmake [-cpu <type>] <output path> <input file>
  *
  * where output path is the path where the output files should be placed, and
  * input file is the file to use for input.
  *
+ * With -cpu (000, 010, 020, 030 or 040), only the handlers that CPU type
+ * can execute are generated, and the table carries only its cycle counts.
+ * Everything else falls through to the illegal instruction handler, so the
+ * core must then be compiled with the matching M68K_SINGLE_CPU_xxx define
+ * (see m68kcpu.h).
+ *
  * If you modify the input file greatly from its released form, you may have
  * to tweak the configuration section a bit since I'm using static allocation
  * to keep things simple.
@@ -260,6 +266,7 @@ static FILE* g_input_file = NULL;
 static FILE* g_prototype_file = NULL;
 static FILE* g_table_file = NULL;
 
+static int g_cpu_select = -1;    /* CPU type to generate for, or -1 for all */
 static int g_num_functions = 0;  /* Number of functions processed */
 static int g_num_primitives = 0; /* Number of function primitives read */
 static int g_line_number = 1;    /* Current line number */
@@ -838,6 +845,12 @@ static void write_table_entry(FILE* filep, opcode_struct* op)
 	fprintf(filep, "\t{%-28s, 0x%04x, 0x%04x, {",
 		op->name, op->op_mask, op->op_match);
 
+	if(g_cpu_select >= 0)
+	{
+		fprintf(filep, "%3d}},\n", op->cycles[g_cpu_select]);
+		return;
+	}
+
 	for(i=0;i<NUM_CPUS;i++)
 	{
 		fprintf(filep, "%3d", op->cycles[i]);
@@ -1045,6 +1058,10 @@ static void process_opcode_handlers(FILE* filep)
 		if(opinfo == NULL)
 			error_exit("Unable to find matching table entry for %s", func_name);
 
+		/* Skip instructions the selected CPU type doesn't have */
+		if(g_cpu_select >= 0 && opinfo->cpus[g_cpu_select] == UNSPECIFIED_CH)
+			continue;
+
 		replace->length = 0;
 
 		/* Generate opcode variants */
@@ -1245,6 +1262,21 @@ int main(int argc, char *argv[])
 	printf("\n\tMusashi v%s 68000, 68008, 68010, 68EC020, 68020, 68EC030, 68030, 68EC040, 68040 emulator\n", g_version);
 	printf("\tCopyright Karl Stenerud\n\n");
 
+	/* Check for a single CPU type to generate for */
+	if(argc > 2 && strcmp(argv[1], "-cpu") == 0)
+	{
+		static const char *const cpu_names[NUM_CPUS] = { "000", "010", "020", "030", "040" };
+
+		for(g_cpu_select = 0;g_cpu_select < NUM_CPUS;g_cpu_select++)
+			if(strcmp(argv[2], cpu_names[g_cpu_select]) == 0)
+				break;
+		if(g_cpu_select == NUM_CPUS)
+			error_exit("Unknown CPU type %s (expected 000, 010, 020, 030 or 040)", argv[2]);
+		printf("\tGenerating handlers for the 68%s only\n\n", argv[2]);
+		argc -= 2;
+		argv += 2;
+	}
+
 	/* Check if output path and source for the input file are given */
 	if(argc > 1)
 	{
@@ -38,6 +38,7 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include "emuopts.h"
 #include "profiler.h"
 #include "debugger.h"
 
@@ -61,6 +62,10 @@
 const int TRIGGER_INT			= -2000;
 const int TRIGGER_SUSPENDTIME	= -4000;
 
+// idle loop detection: how many identical passes make a loop idle, and how long a pass may be
+const int IDLE_LOOP_REPEATS		= 3;
+const int IDLE_LOOP_MAX_CYCLES	= 128;
+
 
 
 //**************************************************************************
@@ -74,6 +79,7 @@ const int TRIGGER_SUSPENDTIME	= -4000;
 device_execute_interface::device_execute_interface(const machine_config &mconfig, device_t &device)
 	: device_interface(device),
 	  m_disabled(false),
+	  m_no_idle_skip(false),
 	  m_vblank_interrupt(NULL),
 	  m_vblank_interrupts_per_frame(0),
 	  m_vblank_interrupt_screen(NULL),
@@ -98,7 +104,20 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	  m_divisor(0),
 	  m_divshift(0),
 	  m_cycles_per_second(0),
-	  m_attoseconds_per_cycle(0)
+	  m_attoseconds_per_cycle(0),
+	  m_idle_skip(false),
+	  m_idle_space(NULL),
+	  m_idle_io_space(NULL),
+	  m_idle_accesses(0),
+	  m_idle_pc(0),
+	  m_idle_state(0),
+	  m_idle_writes(0),
+	  m_idle_pass_writes(0),
+	  m_idle_total(0),
+	  m_idle_pass_cycles(0),
+	  m_idle_repeats(0),
+	  m_idle_cycles(0),
+	  m_idle_loops(0)
 {
 	memset(&m_localtime, 0, sizeof(m_localtime));
 
@@ -130,6 +149,20 @@ void device_execute_interface::static_set_disable(device_t &device)
 }
 
 
+//-------------------------------------------------
+//  static_set_no_idle_skip - configuration helper
+//  to opt a device out of idle loop skipping
+//-------------------------------------------------
+
+void device_execute_interface::static_set_no_idle_skip(device_t &device)
+{
+	device_execute_interface *exec;
+	if (!device.interface(exec))
+		throw emu_fatalerror("MCFG_DEVICE_NO_IDLE_SKIP called on device '%s' with no execute interface", device.tag());
+	exec->m_no_idle_skip = true;
+}
+
+
 //-------------------------------------------------
 //  static_set_vblank_int - configuration helper
 //  to set up VBLANK interrupts on the device
@@ -529,6 +562,21 @@ void device_execute_interface::interface_pre_start()
 	m_profiler = profile_type(index + PROFILER_DEVICE_FIRST);
 	m_inttrigger = index + TRIGGER_INT;
 
+	// skipping idle loops would hide them from the debugger
+	m_idle_skip = !m_no_idle_skip && device().machine().options().idle_skip() && (device().machine().debug_flags & DEBUG_FLAG_ENABLED) == 0;
+
+	// a handler (a timer, a port, a speaker) can return something new or
+	// have a side effect on every access, so we watch for any access that
+	// isn't plain RAM/ROM; without a program space to watch, skip nothing
+	device_memory_interface *memory;
+	if (m_idle_skip && m_device.interface(memory))
+	{
+		m_idle_space = memory->space(AS_PROGRAM);
+		m_idle_io_space = memory->space(AS_IO);
+	}
+	if (m_idle_space == NULL)
+		m_idle_skip = false;
+
 	// fill in the input states and IRQ callback information
 	for (int line = 0; line < ARRAY_LENGTH(m_input); line++)
 		m_input[line].start(this, line);
@@ -572,6 +620,9 @@ void device_execute_interface::interface_pre_reset()
 {
 	// reset the total number of cycles
 	m_totalcycles = 0;
+	m_idle_repeats = 0;
+	m_idle_cycles = 0;
+	m_idle_loops = 0;
 
 	// enable all devices (except for disabled devices)
 	if (!disabled())
@@ -690,6 +741,55 @@ attoseconds_t device_execute_interface::minimum_quantum() const
 }
 
 
+//-------------------------------------------------
+//  check_idle_loop - called on each backward
+//  branch; once a short loop has made the same
+//  pass several times in a row (same registers,
+//  same writes, same cycles, and no access to
+//  anything but RAM/ROM) it can only change when
+//  something outside it does, which happens at
+//  the end of the timeslice, so eat whole passes
+//  up to there
+//-------------------------------------------------
+
+void device_execute_interface::check_idle_loop(offs_t pc, UINT64 state)
+{
+	// the pass is everything since the previous call
+	UINT64 total = m_totalcycles + m_cycles_running - *m_icountptr;
+	UINT64 cycles = total - m_idle_total;
+	UINT64 writes = m_idle_writes;
+	UINT32 accesses = m_idle_space->handler_reads() + m_idle_space->handler_writes();
+	if (m_idle_io_space != NULL)
+		accesses += m_idle_io_space->handler_reads() + m_idle_io_space->handler_writes();
+	bool handler_access = (accesses != m_idle_accesses);
+	m_idle_total = total;
+	m_idle_writes = 0;
+	m_idle_accesses = accesses;
+
+	// anything different starts counting again
+	if (handler_access || pc != m_idle_pc || state != m_idle_state || writes != m_idle_pass_writes || cycles != m_idle_pass_cycles || cycles == 0 || cycles > IDLE_LOOP_MAX_CYCLES)
+	{
+		m_idle_pc = pc;
+		m_idle_state = state;
+		m_idle_pass_writes = writes;
+		m_idle_pass_cycles = cycles;
+		m_idle_repeats = 0;
+		return;
+	}
+	if (++m_idle_repeats < IDLE_LOOP_REPEATS)
+		return;
+
+	// skip whole passes, leaving the last one to run so the loop exits on time
+	int skip = (*m_icountptr - 1) / (int)cycles * (int)cycles;
+	if (skip > 0)
+	{
+		*m_icountptr -= skip;
+		m_idle_cycles += skip;
+		m_idle_loops++;
+	}
+}
+
+
 //-------------------------------------------------
 //  static_timed_trigger_callback - signal a timed
 //  trigger
@@ -111,6 +111,9 @@ enum
 #define MCFG_DEVICE_DISABLE() \
 	device_execute_interface::static_set_disable(*device); \
 
+#define MCFG_DEVICE_NO_IDLE_SKIP() \
+	device_execute_interface::static_set_no_idle_skip(*device); \
+
 #define MCFG_DEVICE_VBLANK_INT(_tag, _func) \
 	device_execute_interface::static_set_vblank_int(*device, _func, _tag); \
 
@@ -159,6 +162,7 @@ public:
 
 	// static inline configuration helpers
 	static void static_set_disable(device_t &device);
+	static void static_set_no_idle_skip(device_t &device);
 	static void static_set_vblank_int(device_t &device, device_interrupt_func function, const char *tag, int rate = 0);
 	static void static_set_periodic_int(device_t &device, device_interrupt_func function, attotime rate);
 
@@ -179,6 +183,12 @@ public:
 	// deprecated, but still needed for older drivers
 	int iloops() const { return m_iloops; }
 
+	// idle loop detection, for CPU cores that report their writes and backward branches
+	void idle_write(offs_t address, UINT32 data) { if (m_idle_skip) m_idle_writes = (m_idle_writes ^ (((UINT64)address << 32) | data)) * U64(0x100000001b3); }
+	void idle_branch(offs_t pc, UINT64 state) { if (m_idle_skip) check_idle_loop(pc, state); }
+	UINT64 idle_cycles_skipped() const { return m_idle_cycles; }
+	UINT32 idle_loops_skipped() const { return m_idle_loops; }
+
 	// suspend/resume
 	void suspend(UINT32 reason, bool eatcycles);
 	void resume(UINT32 reason);
@@ -261,6 +271,7 @@ protected:
 
 	// configuration
 	bool					m_disabled;					// disabled from executing?
+	bool					m_no_idle_skip;				// driver opted out of idle loop skipping?
 	device_interrupt_func	m_vblank_interrupt;			// for interrupts tied to VBLANK
 	int 					m_vblank_interrupts_per_frame;	// usually 1
 	const char *			m_vblank_interrupt_screen;	// the screen that causes the VBLANK interrupt
@@ -302,6 +313,21 @@ protected:
 	UINT32					m_cycles_per_second;		// cycles per second, adjusted for multipliers
 	attoseconds_t			m_attoseconds_per_cycle;	// attoseconds per adjusted clock cycle
 
+	// idle loop detection
+	bool					m_idle_skip;				// skip idle loops on this device?
+	address_space *			m_idle_space;				// program space, to see accesses that go to handlers
+	address_space *			m_idle_io_space;			// I/O space, if any, watched the same way
+	UINT32					m_idle_accesses;			// their handler access count at the last branch
+	offs_t					m_idle_pc;					// branch that closed the last loop pass
+	UINT64					m_idle_state;				// register state at that branch
+	UINT64					m_idle_writes;				// hash of the writes made since then
+	UINT64					m_idle_pass_writes;			// hash of the writes made by the last pass
+	UINT64					m_idle_total;				// total cycles at that branch
+	UINT64					m_idle_pass_cycles;			// cycles taken by the last pass
+	int						m_idle_repeats;				// identical passes seen in a row
+	UINT64					m_idle_cycles;				// total cycles skipped
+	UINT32					m_idle_loops;				// number of times we skipped
+
 private:
 	// callbacks
 	static void static_timed_trigger_callback(running_machine &machine, void *ptr, int param);
@@ -315,6 +341,7 @@ private:
 	void trigger_periodic_interrupt();
 
 	attoseconds_t minimum_quantum() const;
+	void check_idle_loop(offs_t pc, UINT64 state);
 };
 
 
@@ -114,6 +114,7 @@ typedef device_t * (*machine_config_constructor)(machine_config &config, device_
 // the running machine
 #include "machine.h"
 #include "mame.h"
+#include "pacer.h"
 
 // video-related
 #include "drawgfx.h"
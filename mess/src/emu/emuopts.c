@@ -86,6 +86,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ NULL,                                              NULL,        OPTION_HEADER,     "CORE STATE/PLAYBACK OPTIONS" },
 	{ OPTION_STATE,                                      NULL,        OPTION_STRING,     "saved state to load" },
 	{ OPTION_AUTOSAVE,                                   "0",         OPTION_BOOLEAN,    "enable automatic restore at startup, and automatic save at exit time" },
+	{ OPTION_REWIND "(0-3600)",                          "0",         OPTION_INTEGER,    "number of frames of in-memory state history to keep for rewinding; 0 disables" },
 	{ OPTION_PLAYBACK ";pb",                             NULL,        OPTION_STRING,     "playback an input file" },
 	{ OPTION_RECORD ";rec",                              NULL,        OPTION_STRING,     "record an input file" },
 	{ OPTION_MNGWRITE,                                   NULL,        OPTION_STRING,     "optional filename to write a MNG movie of the current session" },
@@ -105,6 +106,10 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SLEEP,                                      "1",         OPTION_BOOLEAN,    "enable sleeping, which gives time back to other applications when idle" },
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       OPTION_FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         OPTION_BOOLEAN,    "automatically adjusts the speed of gameplay to keep the refresh rate lower than the screen" },
+	{ OPTION_MAXCATCHUP "(10-1000)",                    "100",       OPTION_INTEGER,    "maximum milliseconds of emulated time run per host frame when the main loop is paced by the host" },
+	{ OPTION_AUDIOPACE,                                  "0",         OPTION_BOOLEAN,    "when the main loop is paced by the host, run as much emulated time as the audio device has played instead of following the host's clock" },
+	{ OPTION_IDLESKIP,                                   "0",         OPTION_BOOLEAN,    "skip ahead through CPU loops that are only waiting for an interrupt or timer" },
+	{ OPTION_BENCH,                                      "0",         OPTION_INTEGER,    "benchmark for the given number of emulated seconds and report timings on exit; implies -video none -nosound -nothrottle" },
 
 	// rotation options
 	{ NULL,                                              NULL,        OPTION_HEADER,     "CORE ROTATION OPTIONS" },
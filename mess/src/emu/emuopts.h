@@ -99,6 +99,7 @@ enum
 // core state/playback options
 #define OPTION_STATE				"state"
 #define OPTION_AUTOSAVE				"autosave"
+#define OPTION_REWIND				"rewind"
 #define OPTION_PLAYBACK				"playback"
 #define OPTION_RECORD				"record"
 #define OPTION_MNGWRITE				"mngwrite"
@@ -117,6 +118,10 @@ enum
 #define OPTION_SLEEP				"sleep"
 #define OPTION_SPEED				"speed"
 #define OPTION_REFRESHSPEED			"refreshspeed"
+#define OPTION_MAXCATCHUP			"maxcatchup"
+#define OPTION_AUDIOPACE			"audiopace"
+#define OPTION_IDLESKIP				"idleskip"
+#define OPTION_BENCH				"bench"
 
 // core rotation options
 #define OPTION_ROTATE				"rotate"
@@ -250,6 +255,7 @@ public:
 	// core state/playback options
 	const char *state() const { return value(OPTION_STATE); }
 	bool autosave() const { return bool_value(OPTION_AUTOSAVE); }
+	int rewind() const { return int_value(OPTION_REWIND); }
 	const char *playback() const { return value(OPTION_PLAYBACK); }
 	const char *record() const { return value(OPTION_RECORD); }
 	const char *mng_write() const { return value(OPTION_MNGWRITE); }
@@ -268,6 +274,10 @@ public:
 	bool sleep() const { return bool_value(OPTION_SLEEP); }
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return bool_value(OPTION_REFRESHSPEED); }
+	int max_catchup() const { return int_value(OPTION_MAXCATCHUP); }
+	bool audio_pace() const { return bool_value(OPTION_AUDIOPACE); }
+	bool idle_skip() const { return bool_value(OPTION_IDLESKIP); }
+	int bench() const { return int_value(OPTION_BENCH); }
 
 	// core rotation options
 	bool rotate() const { return bool_value(OPTION_ROTATE); }
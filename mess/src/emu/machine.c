@@ -122,17 +122,84 @@
 #ifdef SDLMAME_EMSCRIPTEN
 #include <emscripten.h>
 
-static device_scheduler * scheduler;
+static running_machine * jsmess_machine;
+static frame_pacer * jsmess_pacer;
+
+// supplied by post.js: hands the page the system the user switched to
+extern "C" void jsmess_new_driver(const char *name);
+
+// this is where running_machine::run would fall out of its loop, but its
+// stack is gone, so finish here instead; returns true if the machine is
+// no longer running
+bool jsmess_handle_event(running_machine &machine)
+{
+	if (!machine.scheduled_event_pending() || machine.m_saveload_schedule != running_machine::SLS_NONE)
+		return false;
+
+	// on exit, or a switch to another system (which needs a new machine,
+	// and so the page, to start it), stop the browser loop
+	if (machine.exit_pending() || machine.new_driver_pending())
+	{
+		emscripten_cancel_main_loop();
+		machine.stop();
+		machine.call_notifiers(MACHINE_NOTIFY_EXIT);
+		if (machine.new_driver_pending())
+			jsmess_new_driver(machine.new_driver_name());
+		return true;
+	}
+
+	// a plain hard reset is done in place
+	machine.m_hard_reset_pending = false;
+	machine.soft_reset();
+	return false;
+}
 
 void jsmess_main_loop() {
-  attotime stoptime = scheduler->time() + attotime(0,HZ_TO_ATTOSECONDS(60));
-  while (scheduler->time() < stoptime) {
-	  scheduler->timeslice();
-  }
+	running_machine &machine = *jsmess_machine;
+	if (jsmess_handle_event(machine))
+		return;
+
+	// if paused, just pump video updates through
+	if (machine.paused())
+	{
+		jsmess_pacer->reset();
+		machine.video().frame_update();
+		return;
+	}
+
+	// run as much emulated time as real time has passed since the last callback
+	device_scheduler &sched = machine.scheduler();
+	attotime stoptime = sched.time() + jsmess_pacer->next_slice();
+
+	// when audio clocks us, show only the last frame of a long slice; a
+	// zero slice leaves the previous frame on screen
+	if (jsmess_pacer->audio_paced())
+		machine.video().skip_frames_until(stoptime);
+	while (sched.time() < stoptime && (!machine.scheduled_event_pending() || machine.m_saveload_schedule != running_machine::SLS_NONE))
+	{
+		sched.timeslice();
+		machine.process_saveload();
+	}
+	jsmess_handle_event(machine);
 }
 
-void jsmess_set_main_loop(device_scheduler &sched) {
-	scheduler = &sched;
+// called from JavaScript to step back through the rewind history; returns
+// 0 if there is no history to step back through (disabled, or drivers whose
+// anonymous timers never let a snapshot be taken)
+int jsmess_rewind(int frames)
+{
+	if (jsmess_machine == NULL || !jsmess_machine->rewind_available())
+		return 0;
+	jsmess_machine->schedule_rewind(frames);
+	return 1;
+}
+
+void jsmess_set_main_loop(running_machine &machine) {
+	jsmess_machine = &machine;
+	jsmess_pacer = auto_alloc(machine, frame_pacer(machine));
+
+	// the browser decides when we run, so video throttling must never block
+	machine.video().set_host_paced();
 	emscripten_set_main_loop(&jsmess_main_loop, 0, 1);
 }
 #endif
@@ -205,6 +272,10 @@ running_machine::running_machine(const machine_config &_config, osd_interface &o
 	  m_saveload_schedule(SLS_NONE),
 	  m_saveload_schedule_time(attotime::zero),
 	  m_saveload_searchpath(NULL),
+	  m_rewind_frames(0),
+	  m_rewind_frame(0),
+	  m_rewind_wait_time(attotime::never),
+	  m_rewind_blocked(false),
 	  m_logerror_list(m_respool)
 {
 	memset(gfx, 0, sizeof(gfx));
@@ -352,6 +423,9 @@ void running_machine::start()
 
 	// disallow save state registrations starting here
 	m_save.allow_registration(false);
+
+	// now that the state is known, set up the rewind history
+	m_save.rewind_init(options().rewind());
 }
 
 
@@ -428,7 +502,7 @@ int running_machine::run(bool firstrun)
 
 			#ifdef SDLMAME_EMSCRIPTEN
 			//break out to our async javascript loop and halt
-			jsmess_set_main_loop(m_scheduler);
+			jsmess_set_main_loop(*this);
 			#endif
 			// execute CPUs if not paused
 			if (!m_paused)
@@ -438,20 +512,14 @@ int running_machine::run(bool firstrun)
 			else
 				m_video->frame_update();
 
-			// handle save/load
-			if (m_saveload_schedule != SLS_NONE)
-				handle_saveload();
+			// handle save/load/rewind
+			process_saveload();
 
 			g_profiler.stop();
 		}
 
 		// and out via the exit phase
-		m_current_phase = MACHINE_PHASE_EXIT;
-
-		// save the NVRAM and configuration
-		sound().ui_mute(true);
-		nvram_save(*this);
-		config_save_settings(*this);
+		stop();
 	}
 	catch (emu_fatalerror &fatal)
 	{
@@ -481,6 +549,22 @@ int running_machine::run(bool firstrun)
 }
 
 
+//-------------------------------------------------
+//  stop - move to the exit phase, saving the
+//  NVRAM and configuration
+//-------------------------------------------------
+
+void running_machine::stop()
+{
+	m_current_phase = MACHINE_PHASE_EXIT;
+
+	// save the NVRAM and configuration
+	sound().ui_mute(true);
+	nvram_save(*this);
+	config_save_settings(*this);
+}
+
+
 //-------------------------------------------------
 //  schedule_exit - schedule a clean exit
 //-------------------------------------------------
@@ -790,6 +874,113 @@ void running_machine::call_notifiers(machine_notification which)
 }
 
 
+//-------------------------------------------------
+//  schedule_rewind - schedule a rewind through
+//  the in-memory history to occur as soon as
+//  possible
+//-------------------------------------------------
+
+void running_machine::schedule_rewind(int frames)
+{
+	// rewinds replace any pending save or load
+	m_saveload_pending_file.reset();
+	m_saveload_searchpath = NULL;
+
+	// note the start time so we can give up on anonymous timers
+	m_saveload_schedule = SLS_REWIND;
+	m_saveload_schedule_time = this->time();
+	m_rewind_frames = frames;
+
+	// we can't be paused since we need to clear out anonymous timers
+	resume();
+}
+
+
+//-------------------------------------------------
+//  process_saveload - perform any pending save,
+//  load or rewind, and record rewind history;
+//  called between timeslices
+//-------------------------------------------------
+
+void running_machine::process_saveload()
+{
+	if (m_saveload_schedule == SLS_REWIND)
+		handle_rewind();
+	else if (m_saveload_schedule != SLS_NONE)
+		handle_saveload();
+
+	if (m_save.rewind_depth() > 0)
+		update_rewind();
+}
+
+
+//-------------------------------------------------
+//  handle_rewind - attempt to restore an earlier
+//  state from the rewind history
+//-------------------------------------------------
+
+void running_machine::handle_rewind()
+{
+	// like loads, wait out any anonymous timers so they can't overwrite the restored state
+	if (m_scheduler.anonymous_timers_pending())
+	{
+		if ((this->time() - m_saveload_schedule_time) > attotime::from_seconds(1))
+		{
+			popmessage("Unable to rewind due to pending anonymous timers. See error.log for details.");
+			logerror("Failed rewind attempt due to anonymous timers:\n");
+			m_scheduler.dump_timers();
+			m_saveload_schedule = SLS_NONE;
+		}
+		return;
+	}
+
+	// restore the state; the snapshot we land on is already in the history
+	save_error saverr = m_save.rewind_restore(m_rewind_frames);
+	if (saverr == STATERR_ILLEGAL_REGISTRATIONS)
+		popmessage("Error: Unable to rewind due to illegal registrations. See error.log for details.");
+	else if (saverr == STATERR_NO_HISTORY)
+		popmessage("Error: Unable to rewind %d frames; %d available.", m_rewind_frames, m_save.rewind_count());
+	else if (primary_screen != NULL)
+		m_rewind_frame = primary_screen->frame_number();
+
+	m_saveload_schedule = SLS_NONE;
+}
+
+
+//-------------------------------------------------
+//  update_rewind - add a snapshot to the rewind
+//  history once per frame
+//-------------------------------------------------
+
+void running_machine::update_rewind()
+{
+	// frames are counted on the primary screen
+	if (primary_screen == NULL || primary_screen->frame_number() == m_rewind_frame)
+		return;
+
+	// anonymous timers aren't saved, so try again after the next timeslice;
+	// if they never clear, rewind is reported as unavailable
+	if (m_scheduler.anonymous_timers_pending())
+	{
+		if (m_rewind_wait_time == attotime::never)
+			m_rewind_wait_time = this->time();
+		else if (!m_rewind_blocked && (this->time() - m_rewind_wait_time) > attotime::from_seconds(1))
+		{
+			popmessage("Rewind unavailable due to pending anonymous timers. See error.log for details.");
+			logerror("Rewind history blocked by anonymous timers:\n");
+			m_scheduler.dump_timers();
+			m_rewind_blocked = true;
+		}
+		return;
+	}
+
+	m_rewind_wait_time = attotime::never;
+	m_rewind_blocked = false;
+	m_rewind_frame = primary_screen->frame_number();
+	m_save.rewind_capture();
+}
+
+
 //-------------------------------------------------
 //  handle_saveload - attempt to perform a save
 //  or load
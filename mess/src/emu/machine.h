@@ -315,6 +315,8 @@ class running_machine
 
 	friend void debugger_init(running_machine &machine);
 	friend class sound_manager;
+	friend bool jsmess_handle_event(running_machine &machine);
+	friend void jsmess_main_loop();
 
 	typedef void (*logerror_callback)(running_machine &machine, const char *string);
 
@@ -351,6 +353,7 @@ public:
 	const char *basename() const { return m_basename; }
 	int sample_rate() const { return m_sample_rate; }
 	bool save_or_load_pending() const { return m_saveload_pending_file; }
+	bool rewind_available() const { return m_save.rewind_depth() > 0 && !m_rewind_blocked; }
 	screen_device *first_screen() const { return primary_screen; }
 
 	// additional helpers
@@ -385,6 +388,8 @@ public:
 	void schedule_new_driver(const game_driver &driver);
 	void schedule_save(const char *filename);
 	void schedule_load(const char *filename);
+	void schedule_rewind(int frames);
+	void process_saveload();
 
 	// date & time
 	void base_datetime(system_time &systime);
@@ -439,9 +444,12 @@ public:
 private:
 	// internal helpers
 	void start();
+	void stop();
 	void set_saveload_filename(const char *filename);
 	void fill_systime(system_time &systime, time_t t);
 	void handle_saveload();
+	void handle_rewind();
+	void update_rewind();
 	void soft_reset(void *ptr = NULL, INT32 param = 0);
 
 	// internal callbacks
@@ -491,12 +499,17 @@ private:
 	{
 		SLS_NONE,
 		SLS_SAVE,
-		SLS_LOAD
+		SLS_LOAD,
+		SLS_REWIND
 	};
 	saveload_schedule		m_saveload_schedule;
 	attotime				m_saveload_schedule_time;
 	astring					m_saveload_pending_file;
 	const char *			m_saveload_searchpath;
+	int						m_rewind_frames;		// number of frames to rewind
+	UINT64					m_rewind_frame;			// frame number of the last rewind snapshot
+	attotime				m_rewind_wait_time;		// when anonymous timers started holding off snapshots
+	bool					m_rewind_blocked;		// have they held them off for too long?
 
 	// notifier callbacks
 	struct notifier_callback_item
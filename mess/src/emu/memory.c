@@ -47,6 +47,12 @@
     the macros in LEVEL1_BITS and LEVEL2_BITS, but they default to the
     upper 18 bits and the lower 14 bits.
 
+    Address spaces whose byte range fits within LEVEL1_BITS (8 and 16-bit
+    CPUs, most I/O spaces) skip the split entirely and use a flat table
+    indexed by the whole address. Either way, the level 1 table is only
+    as large as the address range of the space requires, so a 16-bit
+    space costs 64k per table and a 24-bit space costs 1k plus subtables.
+
     The upper half is then used as an index into a lookup table of bytes.
     If the value pulled from the table is between SUBTABLE_BASE and 255,
     then the lower half of the address is needed to resolve the final
@@ -66,6 +72,12 @@
         STATIC_COUNT .. SUBTABLE_BASE - 1 = driver-specific handlers
         SUBTABLE_BASE .. 255 = need to look up lower bits in subtable
 
+    Memory bank entries (STATIC_BANK1 through STATIC_BANKMAX) are resolved
+    inline by the accessors: each table keeps a compact copy of the start
+    and mask of every bank entry alongside the global bank base pointers,
+    so a RAM/ROM access is a table lookup plus a pointer add, and only
+    true I/O handlers pay for a delegate call.
+
     Caveats:
 
     * If your driver executes an opcode which crosses a bank-switched
@@ -809,12 +821,20 @@ public:
 
 	UINT32 lookup(offs_t byteaddress) const
 	{
+		byteaddress &= m_space.bytemask();
 		UINT32 entry = m_live_lookup[level1_index(byteaddress)];
 		if (entry >= SUBTABLE_BASE)
 			entry = m_live_lookup[level2_index(entry, byteaddress)];
 		return entry;
 	}
 
+	// return a pointer to the backing RAM of a bank entry at the given address
+	UINT8 *bank_ramptr(UINT32 entry, offs_t byteaddress) const
+	{
+		const bank_access &bank = m_bankaccess[entry];
+		return m_bankbase[entry] + ((byteaddress - bank.m_bytestart) & bank.m_bytemask);
+	}
+
 	// enable watchpoints by swapping in the watchpoint table
 	void enable_watchpoints(bool enable = true) { m_live_lookup = enable ? s_watchpoint_table : m_table; }
 
@@ -830,7 +850,7 @@ public:
 protected:
 	// determine table indexes based on the address
 	UINT32 level1_index_large(offs_t address) const { return address >> LEVEL2_BITS; }
-	UINT32 level2_index_large(UINT8 l1entry, offs_t address) const { return (1 << LEVEL1_BITS) + ((l1entry - SUBTABLE_BASE) << LEVEL2_BITS) + (address & ((1 << LEVEL2_BITS) - 1)); }
+	UINT32 level2_index_large(UINT8 l1entry, offs_t address) const { return m_level1_size + ((l1entry - SUBTABLE_BASE) << LEVEL2_BITS) + (address & ((1 << LEVEL2_BITS) - 1)); }
 	UINT32 level1_index(offs_t address) const { return m_large ? level1_index_large(address) : address; }
 	UINT32 level2_index(UINT8 l1entry, offs_t address) const { return m_large ? level2_index_large(l1entry, address) : 0; }
 
@@ -847,11 +867,24 @@ protected:
 	void subtable_close(offs_t l1index);
 	UINT8 *subtable_ptr(UINT8 entry) { return &m_table[level2_index(entry, 0)]; }
 
+	// bank fast path management
+	void bank_access_update(UINT8 entry);
+
 	// internal state
 	UINT8 *					m_table;					// pointer to base of table
 	UINT8 *					m_live_lookup;				// current lookup
 	address_space &			m_space;					// pointer back to the space
 	bool					m_large;					// large memory model?
+	UINT32					m_level1_size;				// number of entries in the level 1 table
+
+	// bank_access is a compact copy of the addressing of a memory bank entry
+	struct bank_access
+	{
+		offs_t				m_bytestart;				// byte-adjusted start address of the bank
+		offs_t				m_bytemask;					// byte-adjusted mask against the final address
+	};
+	UINT8 **				m_bankbase;					// pointer to the global bank base pointers
+	bank_access				m_bankaccess[STATIC_BANKMAX + 1];	// addressing of each bank entry
 
 	// subtable_data is an internal class with information about each subtable
 	class subtable_data
@@ -1255,13 +1288,21 @@ public:
 		// look up the handler
 		offs_t byteaddress = offset & m_bytemask;
 		UINT32 entry = read_lookup(byteaddress);
-		const handler_entry_read &handler = m_read.handler_read(entry);
 
-		// either read directly from RAM, or call the delegate
-		offset = handler.byteoffset(byteaddress);
+		// read directly from RAM/ROM banks without touching the handler
 		_NativeType result;
-		if (entry <= STATIC_BANKMAX) result = *reinterpret_cast<_NativeType *>(handler.ramptr(offset));
-		else if (sizeof(_NativeType) == 1) result = handler.read8(*this, offset, mask);
+		if (entry <= STATIC_BANKMAX)
+		{
+			result = *reinterpret_cast<_NativeType *>(m_read.bank_ramptr(entry, byteaddress));
+			g_profiler.stop();
+			return result;
+		}
+
+		// otherwise, call the delegate
+		const handler_entry_read &handler = m_read.handler_read(entry);
+		m_handler_reads++;
+		offset = handler.byteoffset(byteaddress);
+		if (sizeof(_NativeType) == 1) result = handler.read8(*this, offset, mask);
 		else if (sizeof(_NativeType) == 2) result = handler.read16(*this, offset >> 1, mask);
 		else if (sizeof(_NativeType) == 4) result = handler.read32(*this, offset >> 2, mask);
 		else if (sizeof(_NativeType) == 8) result = handler.read64(*this, offset >> 3, mask);
@@ -1280,13 +1321,21 @@ public:
 		// look up the handler
 		offs_t byteaddress = offset & m_bytemask;
 		UINT32 entry = read_lookup(byteaddress);
-		const handler_entry_read &handler = m_read.handler_read(entry);
 
-		// either read directly from RAM, or call the delegate
-		offset = handler.byteoffset(byteaddress);
+		// read directly from RAM/ROM banks without touching the handler
 		_NativeType result;
-		if (entry <= STATIC_BANKMAX) result = *reinterpret_cast<_NativeType *>(handler.ramptr(offset));
-		else if (sizeof(_NativeType) == 1) result = handler.read8(*this, offset, 0xff);
+		if (entry <= STATIC_BANKMAX)
+		{
+			result = *reinterpret_cast<_NativeType *>(m_read.bank_ramptr(entry, byteaddress));
+			g_profiler.stop();
+			return result;
+		}
+
+		// otherwise, call the delegate
+		const handler_entry_read &handler = m_read.handler_read(entry);
+		m_handler_reads++;
+		offset = handler.byteoffset(byteaddress);
+		if (sizeof(_NativeType) == 1) result = handler.read8(*this, offset, 0xff);
 		else if (sizeof(_NativeType) == 2) result = handler.read16(*this, offset >> 1, 0xffff);
 		else if (sizeof(_NativeType) == 4) result = handler.read32(*this, offset >> 2, 0xffffffff);
 		else if (sizeof(_NativeType) == 8) result = handler.read64(*this, offset >> 3, U64(0xffffffffffffffff));
@@ -1303,16 +1352,21 @@ public:
 		// look up the handler
 		offs_t byteaddress = offset & m_bytemask;
 		UINT32 entry = write_lookup(byteaddress);
-		const handler_entry_write &handler = m_write.handler_write(entry);
 
-		// either write directly to RAM, or call the delegate
-		offset = handler.byteoffset(byteaddress);
+		// write directly to RAM banks without touching the handler
 		if (entry <= STATIC_BANKMAX)
 		{
-			_NativeType *dest = reinterpret_cast<_NativeType *>(handler.ramptr(offset));
+			_NativeType *dest = reinterpret_cast<_NativeType *>(m_write.bank_ramptr(entry, byteaddress));
 			*dest = (*dest & ~mask) | (data & mask);
+			g_profiler.stop();
+			return;
 		}
-		else if (sizeof(_NativeType) == 1) handler.write8(*this, offset, data, mask);
+
+		// otherwise, call the delegate
+		const handler_entry_write &handler = m_write.handler_write(entry);
+		m_handler_writes++;
+		offset = handler.byteoffset(byteaddress);
+		if (sizeof(_NativeType) == 1) handler.write8(*this, offset, data, mask);
 		else if (sizeof(_NativeType) == 2) handler.write16(*this, offset >> 1, data, mask);
 		else if (sizeof(_NativeType) == 4) handler.write32(*this, offset >> 2, data, mask);
 		else if (sizeof(_NativeType) == 8) handler.write64(*this, offset >> 3, data, mask);
@@ -1328,12 +1382,20 @@ public:
 		// look up the handler
 		offs_t byteaddress = offset & m_bytemask;
 		UINT32 entry = write_lookup(byteaddress);
-		const handler_entry_write &handler = m_write.handler_write(entry);
 
-		// either write directly to RAM, or call the delegate
+		// write directly to RAM banks without touching the handler
+		if (entry <= STATIC_BANKMAX)
+		{
+			*reinterpret_cast<_NativeType *>(m_write.bank_ramptr(entry, byteaddress)) = data;
+			g_profiler.stop();
+			return;
+		}
+
+		// otherwise, call the delegate
+		const handler_entry_write &handler = m_write.handler_write(entry);
+		m_handler_writes++;
 		offset = handler.byteoffset(byteaddress);
-		if (entry <= STATIC_BANKMAX) *reinterpret_cast<_NativeType *>(handler.ramptr(offset)) = data;
-		else if (sizeof(_NativeType) == 1) handler.write8(*this, offset, data, 0xff);
+		if (sizeof(_NativeType) == 1) handler.write8(*this, offset, data, 0xff);
 		else if (sizeof(_NativeType) == 2) handler.write16(*this, offset >> 1, data, 0xffff);
 		else if (sizeof(_NativeType) == 4) handler.write32(*this, offset >> 2, data, 0xffffffff);
 		else if (sizeof(_NativeType) == 8) handler.write64(*this, offset >> 3, data, U64(0xffffffffffffffff));
@@ -2020,6 +2082,8 @@ address_space::address_space(device_memory_interface &memory, address_spacenum s
 	  m_name(memory.space_config(spacenum)->name()),
 	  m_addrchars((m_config.m_addrbus_width + 3) / 4),
 	  m_logaddrchars((m_config.m_logaddr_width + 3) / 4),
+	  m_handler_reads(0),
+	  m_handler_writes(0),
 	  m_machine(memory.device().machine())
 {
 	// notify the device
@@ -2124,6 +2188,10 @@ address_space &address_space::allocate(running_machine &machine, const address_s
 
 inline void address_space::adjust_addresses(offs_t &start, offs_t &end, offs_t &mask, offs_t &mirror)
 {
+	// mirror bits above the space would index past the end of a level 1
+	// table sized to the space
+	mirror &= m_addrmask;
+
 	// adjust start/end/mask values
 	if (mask == 0)
 		mask = m_addrmask & ~mirror;
@@ -3290,19 +3358,25 @@ memory_bank &address_space::bank_find_or_allocate(const char *tag, offs_t addrst
 //-------------------------------------------------
 
 address_table::address_table(address_space &space, bool large)
-	: m_table(auto_alloc_array(space.machine(), UINT8, 1 << LEVEL1_BITS)),
-	  m_live_lookup(m_table),
+	: m_table(NULL),
+	  m_live_lookup(NULL),
 	  m_space(space),
 	  m_large(large),
+	  m_level1_size(large ? (space.bytemask() >> LEVEL2_BITS) + 1 : space.bytemask() + 1),
+	  m_bankbase(space.machine().memory_data->bank_ptr),
 	  m_subtable(auto_alloc_array(space.machine(), subtable_data, SUBTABLE_COUNT)),
 	  m_subtable_alloc(0)
 {
+	// size the level 1 table to cover only the address range of the space
+	assert(m_level1_size <= (1 << LEVEL1_BITS));
+	m_table = m_live_lookup = auto_alloc_array(space.machine(), UINT8, m_level1_size);
+
 	// make our static table all watchpoints
 	if (s_watchpoint_table[0] != STATIC_WATCHPOINT)
 		memset(s_watchpoint_table, STATIC_WATCHPOINT, sizeof(s_watchpoint_table));
 
 	// initialize everything to unmapped
-	memset(m_table, STATIC_UNMAP, 1 << LEVEL1_BITS);
+	memset(m_table, STATIC_UNMAP, m_level1_size);
 
 	// initialize the handlers freelist
 	for (int i=0; i != SUBTABLE_BASE-STATIC_COUNT-1; i++)
@@ -3312,6 +3386,9 @@ address_table::address_table(address_space &space, bool large)
 
 	// initialize the handlers refcounts
 	memset(handler_refcount, 0, sizeof(handler_refcount));
+
+	// no banks are mapped yet
+	memset(m_bankaccess, 0, sizeof(m_bankaccess));
 }
 
 
@@ -3349,6 +3426,8 @@ void address_table::map_range(offs_t addrstart, offs_t addrend, offs_t addrmask,
 	handler_entry &curentry = handler(entry);
 	if (entry <= STATIC_BANKMAX || entry >= STATIC_COUNT)
 		curentry.configure(bytestart, byteend, bytemask);
+	if (entry <= STATIC_BANKMAX)
+		bank_access_update(entry);
 
 	// populate it
 	populate_range_mirrored(bytestart, byteend, bytemirror, entry);
@@ -3544,7 +3623,7 @@ void address_table::verify_reference_counts()
 	bool subtable_seen[256 - SUBTABLE_BASE];
 	memset(subtable_seen, 0, sizeof(subtable_seen));
 
-	for (int level1 = 0; level1 != 1 << LEVEL1_BITS; level1++)
+	for (UINT32 level1 = 0; level1 != m_level1_size; level1++)
 	{
 		UINT8 l1_entry = m_table[level1];
 		if (l1_entry >= SUBTABLE_BASE)
@@ -3669,6 +3748,8 @@ void address_table::populate_range(offs_t bytestart, offs_t byteend, UINT8 handl
 
 void address_table::populate_range_mirrored(offs_t bytestart, offs_t byteend, offs_t bytemirror, UINT8 handlerindex)
 {
+	assert((bytemirror & ~m_space.bytemask()) == 0);
+
 	// determine the mirror bits
 	offs_t lmirrorbits = 0;
 	offs_t lmirrorbit[32];
@@ -3858,6 +3939,24 @@ void address_table::mask_all_handlers(offs_t mask)
 	// we don't loop over map entries because the mask applies to static handlers as well
 	for (int entrynum = 0; entrynum < ENTRY_COUNT; entrynum++)
 		handler(entrynum).apply_mask(mask);
+
+	// keep the bank fast path in sync
+	for (int entrynum = STATIC_BANK1; entrynum <= STATIC_BANKMAX; entrynum++)
+		bank_access_update(entrynum);
+}
+
+
+//-------------------------------------------------
+//  bank_access_update - refresh the inline copy
+//  of a bank entry's addressing from its handler
+//-------------------------------------------------
+
+void address_table::bank_access_update(UINT8 entry)
+{
+	assert(entry >= STATIC_BANK1 && entry <= STATIC_BANKMAX);
+	const handler_entry &curentry = handler(entry);
+	m_bankaccess[entry].m_bytestart = curentry.bytestart();
+	m_bankaccess[entry].m_bytemask = curentry.bytemask();
 }
 
 
@@ -3883,9 +3982,9 @@ UINT8 address_table::subtable_alloc()
 				// if this is past our allocation budget, allocate some more
 				if (subindex >= m_subtable_alloc)
 				{
-					UINT32 oldsize = (1 << LEVEL1_BITS) + (m_subtable_alloc << level2_bits());
+					UINT32 oldsize = m_level1_size + (m_subtable_alloc << level2_bits());
 					m_subtable_alloc += SUBTABLE_ALLOC;
-					UINT32 newsize = (1 << LEVEL1_BITS) + (m_subtable_alloc << level2_bits());
+					UINT32 newsize = m_level1_size + (m_subtable_alloc << level2_bits());
 
 					UINT8 *newtable = auto_alloc_array_clear(m_space.machine(), UINT8, newsize);
 					memcpy(newtable, m_table, oldsize);
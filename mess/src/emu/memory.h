@@ -330,6 +330,8 @@ public:
 	offs_t logaddrmask() const { return m_logaddrmask; }
 	offs_t logbytemask() const { return m_logbytemask; }
 	UINT8 logaddrchars() const { return m_logaddrchars; }
+	UINT32 handler_reads() const { return m_handler_reads; }
+	UINT32 handler_writes() const { return m_handler_writes; }
 
 	// debug helpers
 	const char *get_handler_string(read_or_write readorwrite, offs_t byteaddress);
@@ -552,6 +554,8 @@ protected:
 	const char *			m_name;				// friendly name of the address space
 	UINT8					m_addrchars;		// number of characters to use for physical addresses
 	UINT8					m_logaddrchars;		// number of characters to use for logical addresses
+	UINT32					m_handler_reads;	// reads that went to a handler rather than RAM/ROM
+	UINT32					m_handler_writes;	// writes that went to a handler rather than RAM
 
 private:
 	running_machine &		m_machine;			// reference to the owning machine
@@ -0,0 +1,214 @@
+/***************************************************************************
+
+    pacer.c
+
+    Host-paced main loop timing.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "emuopts.h"
+
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// largest audio rate correction, in 1/100ths of a percent; 0.2% shifts
+// pitch by about 3.5 cents, well under what anyone can hear
+const INT32 MAX_RATE_ADJUST = 20;
+
+
+
+//**************************************************************************
+//  FRAME PACER
+//**************************************************************************
+
+//-------------------------------------------------
+//  frame_pacer - constructor
+//-------------------------------------------------
+
+frame_pacer::frame_pacer(running_machine &machine)
+	: m_machine(machine),
+	  m_max_slice(attotime::from_msec(machine.options().max_catchup())),
+	  m_last_ticks(0),
+	  m_slices(0),
+	  m_clamped_slices(0),
+	  m_dropped_time(attotime::zero),
+	  m_rate_adjust(0),
+	  m_audio_paced(machine.options().audio_pace()),
+	  m_audio_started(false),
+	  m_last_consumed(0)
+{
+}
+
+
+//-------------------------------------------------
+//  reset - forget the previous callback time;
+//  the next slice will be a single frame
+//-------------------------------------------------
+
+void frame_pacer::reset()
+{
+	m_last_ticks = 0;
+}
+
+
+//-------------------------------------------------
+//  next_slice - return the amount of emulated
+//  time to run for this host callback
+//-------------------------------------------------
+
+attotime frame_pacer::next_slice()
+{
+	osd_ticks_t current_ticks = osd_ticks();
+	osd_ticks_t diff_ticks = current_ticks - m_last_ticks;
+	bool first = (m_last_ticks == 0);
+	m_last_ticks = current_ticks;
+	m_slices++;
+
+	// with no previous callback to measure against, run a single frame
+	if (first)
+		return default_slice();
+
+	// let the audio device clock us if asked, once it has started playing
+	attotime slice;
+	if (m_audio_paced && audio_slice(slice))
+		return slice;
+
+	// convert the elapsed real time to emulated time, honoring the speed factor
+	attoseconds_t attoseconds_per_tick = ATTOSECONDS_PER_SECOND / osd_ticks_per_second();
+	if (diff_ticks < osd_ticks_per_second())
+		slice = attotime(0, diff_ticks * attoseconds_per_tick);
+	else
+		slice = attotime(diff_ticks / osd_ticks_per_second(), (diff_ticks % osd_ticks_per_second()) * attoseconds_per_tick);
+	int speed = machine().video().speed_factor();
+	if (speed != 0 && speed != 100)
+		slice = (slice * speed) / 100;
+
+	slice = adjust_for_audio(slice);
+
+	// if the host fell too far behind, drop the excess rather than trying to catch up
+	if (slice > m_max_slice)
+	{
+		m_clamped_slices++;
+		m_dropped_time += slice - m_max_slice;
+		slice = m_max_slice;
+	}
+	return slice;
+}
+
+
+//-------------------------------------------------
+//  adjust_for_audio - stretch or shrink a slice
+//  by up to MAX_RATE_ADJUST to move the OSD's
+//  queued sound toward its target
+//-------------------------------------------------
+
+attotime frame_pacer::adjust_for_audio(attotime slice)
+{
+	osd_audio_status status;
+	if (!machine().osd().get_audio_status(status) || status.target == 0)
+	{
+		m_rate_adjust = 0;
+		return slice;
+	}
+
+	// proportional control: a queue at half its target runs half the maximum faster
+	INT64 error = (INT64)status.target - (INT64)status.buffered;
+	m_rate_adjust = (INT32)(error * MAX_RATE_ADJUST / (INT64)status.target);
+	m_rate_adjust = MAX(-MAX_RATE_ADJUST, MIN(MAX_RATE_ADJUST, m_rate_adjust));
+	return (slice * (UINT32)(10000 + m_rate_adjust)) / 10000;
+}
+
+
+//-------------------------------------------------
+//  audio_slice - compute a slice from the audio
+//  played since the last callback; returns false
+//  if the audio device isn't playing yet
+//-------------------------------------------------
+
+bool frame_pacer::audio_slice(attotime &slice)
+{
+	osd_audio_status status;
+	if (!machine().osd().get_audio_status(status) || machine().sample_rate() == 0)
+		return false;
+
+	// until the device starts (once the OSD has queued its target), fill by real time
+	UINT32 played = status.consumed - m_last_consumed;
+	m_last_consumed = status.consumed;
+	if (!m_audio_started && played == 0)
+		return false;
+	m_audio_started = true;
+
+	// replace what was played, and close an eighth of any gap to the target
+	INT32 frames = played + ((INT32)status.target - (INT32)status.buffered) / 8;
+	if (frames <= 0)
+	{
+		slice = attotime::zero;
+		return true;
+	}
+
+	// sound is produced at the sample rate of emulated time scaled by the speed factor
+	slice = attotime::from_hz(machine().sample_rate()) * frames;
+	int speed = machine().video().speed_factor();
+	if (speed != 0 && speed != 100)
+		slice = (slice * speed) / 100;
+
+	// as with real time, never try to run more than the maximum
+	if (slice > m_max_slice)
+	{
+		m_clamped_slices++;
+		m_dropped_time += slice - m_max_slice;
+		slice = m_max_slice;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  default_slice - return the frame period of
+//  the fastest screen, or the default frame
+//  period for screenless systems
+//-------------------------------------------------
+
+attotime frame_pacer::default_slice() const
+{
+	attotime period = screen_device::DEFAULT_FRAME_PERIOD;
+	for (screen_device *screen = machine().first_screen(); screen != NULL; screen = screen->next_screen())
+		if (screen->frame_period().attoseconds != 0)
+			period = min(period, screen->frame_period());
+	return min(period, m_max_slice);
+}
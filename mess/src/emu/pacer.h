@@ -0,0 +1,117 @@
+/***************************************************************************
+
+    pacer.h
+
+    Host-paced main loop timing.
+
+****************************************************************************
+
+    Copyright Aaron Giles
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are
+    met:
+
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in
+          the documentation and/or other materials provided with the
+          distribution.
+        * Neither the name 'MAME' nor the names of its contributors may be
+          used to endorse or promote products derived from this software
+          without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY AARON GILES ''AS IS'' AND ANY EXPRESS OR
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL AARON GILES BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+    STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+    IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+****************************************************************************
+
+    When the host owns the main loop (the Emscripten build hands control
+    to the browser, which calls us back once per display frame), we
+    cannot simply run one emulated frame per callback: callbacks arrive
+    at the host's refresh rate, not the machine's, and slow hosts get
+    called back late. The frame_pacer measures the real time elapsed
+    between callbacks and hands back a matching amount of emulated time
+    to run, clamped to a configurable maximum so that a slow host drops
+    time instead of spiralling further and further behind.
+
+    The host's clock and the audio device's clock never quite agree, so
+    the pacer also watches how much sound the OSD has queued and runs
+    very slightly fast or slow to hold it at the OSD's target latency.
+
+    With -audiopace, the audio device is the clock instead: each slice
+    is the time the device played since the previous callback, plus a
+    share of whatever the queue is short of its target. The host's rate
+    then only decides how often frames are shown, so sound never glitches
+    and the queue can be kept short.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __EMU_H__
+#error Dont include this file directly; include emu.h instead.
+#endif
+
+#ifndef __PACER_H__
+#define __PACER_H__
+
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> frame_pacer
+
+class frame_pacer
+{
+public:
+	// construction/destruction
+	frame_pacer(running_machine &machine);
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+	attotime max_slice() const { return m_max_slice; }
+	UINT32 slices() const { return m_slices; }
+	UINT32 clamped_slices() const { return m_clamped_slices; }
+	attotime dropped_time() const { return m_dropped_time; }
+	INT32 rate_adjust() const { return m_rate_adjust; }
+	bool audio_paced() const { return m_audio_paced; }
+
+	// pacing
+	void reset();
+	attotime next_slice();
+
+private:
+	// internal helpers
+	attotime default_slice() const;
+	attotime adjust_for_audio(attotime slice);
+	bool audio_slice(attotime &slice);
+
+	// internal state
+	running_machine &	m_machine;					// reference to our machine
+	attotime			m_max_slice;				// most emulated time we will run per callback
+	osd_ticks_t			m_last_ticks;				// osd_ticks at the previous callback (0 == none)
+	UINT32				m_slices;					// total number of slices handed out
+	UINT32				m_clamped_slices;			// number of slices clamped to m_max_slice
+	attotime			m_dropped_time;				// total real time we gave up on catching up
+	INT32				m_rate_adjust;				// last audio rate correction, in 1/100ths of a percent
+	bool				m_audio_paced;				// run what the audio device played instead of real time
+	bool				m_audio_started;			// has the audio device started playing yet?
+	UINT32				m_last_consumed;			// audio frames played as of the previous callback
+};
+
+
+#endif	/* __PACER_H__ */
@@ -101,10 +101,12 @@ real_profiler_state::real_profiler_state()
 	: m_enabled(false),
 	  m_dataready(false),
 	  m_filoindex(0),
-	  m_dataindex(0)
+	  m_dataindex(0),
+	  m_total_context_switches(0)
 {
 	memset(m_filo, 0, sizeof(m_filo));
 	memset(m_data, 0, sizeof(m_data));
+	memset(m_total, 0, sizeof(m_total));
 }
 
 
@@ -120,14 +122,17 @@ void real_profiler_state::real_start(profile_type type)
 	// track context switches
 	history_data &data = m_data[m_dataindex];
 	if (type >= PROFILER_DEVICE_FIRST && type <= PROFILER_DEVICE_MAX)
+	{
 		data.context_switches++;
+		m_total_context_switches++;
+	}
 
 	// we're starting a new bucket, begin now
 	int index = m_filoindex++;
 	filo_entry &entry = m_filo[index];
 
 	// fail if we overflow
-	if (index > ARRAY_LENGTH(m_filo))
+	if (index >= ARRAY_LENGTH(m_filo))
 		throw emu_fatalerror("Profiler FILO overflow (type = %d)\n", type);
 
 	// if we're nested, stop the previous entry
@@ -135,6 +140,7 @@ void real_profiler_state::real_start(profile_type type)
 	{
 		filo_entry &preventry = m_filo[index - 1];
 		data.duration[preventry.type] += curticks - preventry.start;
+		m_total[preventry.type] += curticks - preventry.start;
 	}
 
 	// fill in this entry
@@ -160,6 +166,7 @@ void real_profiler_state::real_stop()
 		// account for the time taken
 		history_data &data = m_data[m_dataindex];
 		data.duration[entry.type] += curticks - entry.start;
+		m_total[entry.type] += curticks - entry.start;
 
 		// if we have a previous entry, restart his time now
 		if (index != 0)
@@ -120,6 +120,8 @@ public:
 	// getters
 	bool enabled() const { return m_enabled; }
 	const char *text(running_machine &machine, astring &string);
+	UINT64 total(profile_type type) const { return m_total[type]; }
+	UINT64 total_context_switches() const { return m_total_context_switches; }
 
 	// enable/disable
 	void enable(bool state = true)
@@ -131,6 +133,8 @@ public:
 			{
 				m_dataready = false;
 				m_filoindex = m_dataindex = 0;
+				m_total_context_switches = 0;
+				memset(m_total, 0, sizeof(m_total));
 			}
 		}
 	}
@@ -164,6 +168,8 @@ private:
 	UINT8				m_dataindex;				// current data index
 	filo_entry			m_filo[16];					// array of FILO entries
 	history_data		m_data[16];					// array of data
+	UINT32				m_total_context_switches;	// context switches since enabled
+	UINT64				m_total[PROFILER_TOTAL];	// duration spent in each entry since enabled
 };
 
 
@@ -178,6 +184,8 @@ public:
 	// getters
 	bool enabled() const { return false; }
 	const char *text(running_machine &machine, astring &string) { return string.cpy(""); }
+	UINT64 total(profile_type type) const { return 0; }
+	UINT64 total_context_switches() const { return 0; }
 
 	// enable/disable
 	void enable(bool state = true) { }
@@ -364,10 +364,14 @@ render_texture::render_texture()
 	  m_scaler(NULL),
 	  m_param(NULL),
 	  m_curseq(0),
+	  m_contentid(0),
+	  m_dirtyfrom(0),
+	  m_palette_serial(0),
 	  m_bcglookup(NULL),
 	  m_bcglookup_entries(0)
 {
 	m_sbounds.min_x = m_sbounds.min_y = m_sbounds.max_x = m_sbounds.max_y = 0;
+	m_dirty.min_x = m_dirty.min_y = m_dirty.max_x = m_dirty.max_y = 0;
 	memset(m_scaled, 0, sizeof(m_scaled));
 }
 
@@ -392,6 +396,9 @@ void render_texture::reset(render_manager &manager, texture_scaler_func scaler,
 	m_manager = &manager;
 	m_scaler = scaler;
 	m_param = param;
+	m_contentid = manager.next_content_id();
+	m_dirtyfrom = 0;
+	m_palette_serial = 0;
 }
 
 
@@ -461,6 +468,10 @@ void render_texture::set_bitmap(bitmap_t *bitmap, const rectangle *sbounds, int
 	m_palette = palette;
 	m_format = format;
 
+	// the contents are new, and not known to relate to anything before
+	m_contentid = m_manager->next_content_id();
+	m_dirtyfrom = 0;
+
 	// invalidate all scaled versions
 	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
 	{
@@ -475,6 +486,23 @@ void render_texture::set_bitmap(bitmap_t *bitmap, const rectangle *sbounds, int
 }
 
 
+//-------------------------------------------------
+//  set_dirty - note that, apart from the given
+//  area of the bitmap, the contents just set by
+//  set_bitmap match the current contents of
+//  another texture
+//-------------------------------------------------
+
+void render_texture::set_dirty(const render_texture &previous, const rectangle &dirty)
+{
+	m_dirtyfrom = previous.m_contentid;
+	m_dirty.min_x = dirty.min_x - m_sbounds.min_x;
+	m_dirty.max_x = dirty.max_x - m_sbounds.min_x;
+	m_dirty.min_y = dirty.min_y - m_sbounds.min_y;
+	m_dirty.max_y = dirty.max_y - m_sbounds.min_y;
+}
+
+
 //-------------------------------------------------
 //  hq_scale - generic high quality resampling
 //  scaler
@@ -514,6 +542,9 @@ bool render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 		texinfo.height = sheight;
 		texinfo.palette = palbase;
 		texinfo.seqid = ++m_curseq;
+		texinfo.contentid = m_contentid;
+		texinfo.dirtyfrom = m_dirtyfrom;
+		texinfo.dirty = m_dirty;
 		return true;
 	}
 
@@ -564,6 +595,8 @@ bool render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 	texinfo.height = dheight;
 	texinfo.palette = palbase;
 	texinfo.seqid = scaled->seqid;
+	texinfo.contentid = m_contentid;
+	texinfo.dirtyfrom = 0;
 	return true;
 }
 
@@ -578,6 +611,17 @@ const rgb_t *render_texture::get_adjusted_palette(render_container &container)
 	const rgb_t *adjusted;
 	int numentries;
 
+	// if the container's palette or lookups changed, so did our final colors
+	if (m_palette_serial != container.palette_serial())
+	{
+		m_palette_serial = container.palette_serial();
+		if (m_format != TEXFORMAT_ARGB32)
+		{
+			m_contentid = m_manager->next_content_id();
+			m_dirtyfrom = 0;
+		}
+	}
+
 	// override the palette with our adjusted palette
 	switch (m_format)
 	{
@@ -707,7 +751,8 @@ render_container::render_container(render_manager &manager, screen_device *scree
 	  m_screen(screen),
 	  m_overlaybitmap(NULL),
 	  m_overlaytexture(NULL),
-	  m_palclient(NULL)
+	  m_palclient(NULL),
+	  m_palette_serial(0)
 {
 	// all palette entries are opaque by default
 	for (int color = 0; color < ARRAY_LENGTH(m_bcglookup); color++)
@@ -939,6 +984,9 @@ render_container::item &render_container::add_generic(UINT8 type, float x0, floa
 
 void render_container::recompute_lookups()
 {
+	// textures using our lookups need to know
+	m_palette_serial++;
+
 	// recompute the 256 entry lookup table
 	for (int i = 0; i < 0x100; i++)
 	{
@@ -996,6 +1044,8 @@ void render_container::update_palette()
 	// iterate over dirty items and update them
 	if (dirty != NULL)
 	{
+		m_palette_serial++;
+
 		palette_t *palette = palette_client_get_palette(m_palclient);
 		const pen_t *adjusted_palette = palette_entry_list_adjusted(palette);
 
@@ -1836,10 +1886,11 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					int height = (finalorient & ORIENTATION_SWAP_XY) ? (prim->bounds.x1 - prim->bounds.x0) : (prim->bounds.y1 - prim->bounds.y0);
 					width = MIN(width, m_maxtexwidth);
 					height = MIN(height, m_maxtexheight);
+					const rgb_t *palette = curitem->texture()->get_adjusted_palette(container);
 					if (curitem->texture()->get_scaled(width, height, prim->texture, list))
 					{
 						// set the palette
-						prim->texture.palette = curitem->texture()->get_adjusted_palette(container);
+						prim->texture.palette = palette;
 
 						// determine UV coordinates and apply clipping
 						prim->texcoords = oriented_texcoords[finalorient];
@@ -2473,6 +2524,8 @@ render_manager::render_manager(running_machine &machine)
 	  m_targetlist(machine.respool()),
 	  m_ui_target(NULL),
 	  m_live_textures(0),
+	  m_dirty_tracking(false),
+	  m_content_id(0),
 	  m_texture_allocator(machine.respool()),
 	  m_ui_container(auto_alloc(machine, render_container(*this))),
 	  m_screen_container_list(machine.respool())
@@ -231,6 +231,9 @@ struct render_texinfo
 	UINT32				height;				// height of the image
 	const rgb_t *		palette;			// palette for PALETTE16 textures, LUTs for RGB15/RGB32
 	UINT32				seqid;				// sequence ID
+	UINT32				contentid;			// ID of the final texel colors; changes whenever they may have
+	UINT32				dirtyfrom;			// contentid that the dirty rectangle is relative to, or 0
+	rectangle			dirty;				// texels that differ from those of contentid 'dirtyfrom'
 };
 
 
@@ -438,6 +441,7 @@ public:
 
 	// configure the texture bitmap
 	void set_bitmap(bitmap_t *bitmap, const rectangle *sbounds, int format, palette_t *palette = NULL);
+	void set_dirty(const render_texture &previous, const rectangle &dirty);
 
 	// generic high-quality bitmap scaler
 	static void hq_scale(bitmap_t &dest, const bitmap_t &source, const rectangle &sbounds, void *param);
@@ -466,6 +470,10 @@ private:
 	texture_scaler_func	m_scaler;					// scaling callback
 	void *				m_param;					// scaling callback parameter
 	UINT32				m_curseq;					// current sequence number
+	UINT32				m_contentid;				// ID of the current contents
+	UINT32				m_dirtyfrom;				// ID of the contents m_dirty is relative to, or 0
+	rectangle			m_dirty;					// bitmap area changed since contents m_dirtyfrom
+	UINT32				m_palette_serial;			// container palette serial the contents reflect
 	scaled_texture		m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
 	rgb_t *				m_bcglookup;				// dynamically allocated B/C/G lookup table
 	UINT32				m_bcglookup_entries;		// number of B/C/G lookup entries allocated
@@ -536,6 +544,7 @@ public:
 	UINT8 apply_brightness_contrast_gamma(UINT8 value);
 	float apply_brightness_contrast_gamma_fp(float value);
 	const rgb_t *bcg_lookup_table(int texformat, palette_t *palette = NULL);
+	UINT32 palette_serial() const { return m_palette_serial; }
 
 private:
 	// an item describes a high level primitive that is added to a container
@@ -586,6 +595,7 @@ private:
 	bitmap_t *				m_overlaybitmap;		// overlay bitmap
 	render_texture *		m_overlaytexture;		// overlay texture
 	palette_client *		m_palclient;			// client to the system palette
+	UINT32					m_palette_serial;		// bumped whenever the palette or lookups change
 	rgb_t					m_bcglookup256[0x400];	// lookup table for brightness/contrast/gamma
 	rgb_t					m_bcglookup32[0x80];	// lookup table for brightness/contrast/gamma
 	rgb_t					m_bcglookup[0x10000];	// full palette lookup with bcg adjustements
@@ -732,6 +742,7 @@ private:
 class render_manager
 {
 	friend class render_target;
+	friend class render_texture;
 
 public:
 	// construction/destruction
@@ -745,6 +756,10 @@ public:
 	bool is_live(screen_device &screen) const;
 	float max_update_rate() const;
 
+	// dirty rectangles, computed by screens only for OSDs that ask for them
+	bool dirty_tracking() const { return m_dirty_tracking; }
+	void set_dirty_tracking(bool enable) { m_dirty_tracking = enable; }
+
 	// targets
 	render_target *target_alloc(const char *layoutfile = NULL, UINT32 flags = 0);
 	void target_free(render_target *target);
@@ -771,6 +786,9 @@ public:
 	void invalidate_all(void *refptr);
 
 private:
+	// texture contents
+	UINT32 next_content_id() { return ++m_content_id; }
+
 	// containers
 	render_container *container_alloc(screen_device *screen = NULL);
 	void container_free(render_container *container);
@@ -788,6 +806,8 @@ private:
 
 	// texture lists
 	UINT32							m_live_textures;	// number of live textures
+	bool							m_dirty_tracking;	// does the OSD use texture dirty rectangles?
+	UINT32							m_content_id;		// last texture content ID handed out
 	fixed_allocator<render_texture>	m_texture_allocator;// texture allocator
 
 	// containers for the UI and for screens
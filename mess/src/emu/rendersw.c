@@ -528,6 +528,15 @@ INLINE UINT32 get_texel_argb32_bilinear(const render_texinfo *texture, INT32 cur
 #define GET_TEXEL(type)				get_texel_##type##_##nearest
 #endif
 
+/* row case: unfiltered and with v constant along each row, so a row can be
+   read straight out of one texture row in a loop the compiler can vectorize */
+#undef QUAD_ROW_CASE
+#define QUAD_ROW_CASE(dvdx)			(!BILINEAR_FILTER && (dvdx) == 0)
+
+/* integer upscale of a row case: every texel spans the same whole number of pixels */
+#undef QUAD_INTEGER_SCALE
+#define QUAD_INTEGER_SCALE(u, dudx)	((u) >= 0 && (dudx) > 0 && (dudx) < 0x10000 && 0x10000 % (dudx) == 0)
+
 
 
 /***************************************************************************
@@ -727,7 +736,7 @@ static void FUNC_PREFIX(draw_line)(const render_primitive *prim, void *dstdata,
     draw_rect - draw a solid rectangle
 -------------------------------------------------*/
 
-static void FUNC_PREFIX(draw_rect)(const render_primitive *prim, void *dstdata, INT32 width, INT32 height, UINT32 pitch)
+static void FUNC_PREFIX(draw_rect)(const render_primitive *prim, void *dstdata, INT32 width, INT32 height, UINT32 pitch, const rectangle *clip)
 {
 	render_bounds fpos = prim->bounds;
 	INT32 startx, starty, endx, endy;
@@ -752,6 +761,15 @@ static void FUNC_PREFIX(draw_rect)(const render_primitive *prim, void *dstdata,
 	if (endy < 0) endy = 0;
 	if (endy >= height) endy = height;
 
+	/* apply the caller's clip */
+	if (clip != NULL)
+	{
+		startx = MAX(startx, clip->min_x);
+		starty = MAX(starty, clip->min_y);
+		endx = MIN(endx, clip->max_x + 1);
+		endy = MIN(endy, clip->max_y + 1);
+	}
+
 	/* bail if nothing left */
 	if (fpos.x0 > fpos.x1 || fpos.y0 > fpos.y1)
 		return;
@@ -838,6 +856,7 @@ static void FUNC_PREFIX(draw_rect)(const render_primitive *prim, void *dstdata,
 
 static void FUNC_PREFIX(draw_quad_palette16_none)(const render_primitive *prim, void *dstdata, UINT32 pitch, quad_setup_data *setup)
 {
+	const UINT16 *prevrow = NULL;
 	INT32 dudx = setup->dudx;
 	INT32 dvdx = setup->dvdx;
 	INT32 endx = setup->endx;
@@ -856,6 +875,48 @@ static void FUNC_PREFIX(draw_quad_palette16_none)(const render_primitive *prim,
 			INT32 curu = setup->startu + (y - setup->starty) * setup->dudy;
 			INT32 curv = setup->startv + (y - setup->starty) * setup->dvdy;
 
+			/* row case: the whole row comes from one row of the texture */
+			if (QUAD_ROW_CASE(dvdx))
+			{
+				const UINT16 *texrow = (const UINT16 *)prim->texture.base + (curv >> 16) * prim->texture.rowpixels;
+				const rgb_t *palette = prim->texture.palette;
+				INT32 count = endx - setup->startx;
+
+				/* a row reading the same texels as the one above is a copy of it */
+				if (setup->dudy == 0 && texrow == prevrow)
+				{
+					memcpy(dest, dest - pitch, count * sizeof(*dest));
+					continue;
+				}
+				prevrow = texrow;
+
+				if (dudx == 0x10000)
+				{
+					texrow += curu >> 16;
+					for (x = 0; x < count; x++)
+						dest[x] = SOURCE32_TO_DEST(palette[texrow[x]]);
+				}
+				else if (QUAD_INTEGER_SCALE(curu, dudx))
+				{
+					/* each texel covers a run of 0x10000 / dudx pixels after the first */
+					INT32 run = (0x10000 - (curu & 0xffff) + dudx - 1) / dudx;
+					texrow += curu >> 16;
+					for (x = 0; x < count; texrow++, run = 0x10000 / dudx)
+					{
+						PIXEL_TYPE pix = SOURCE32_TO_DEST(palette[*texrow]);
+						INT32 end = MIN(x + run, count);
+						while (x < end)
+							dest[x++] = pix;
+					}
+				}
+				else
+				{
+					for (x = 0; x < count; x++, curu += dudx)
+						dest[x] = SOURCE32_TO_DEST(palette[texrow[curu >> 16]]);
+				}
+				continue;
+			}
+
 			/* loop over cols */
 			for (x = setup->startx; x < endx; x++)
 			{
@@ -1486,6 +1547,7 @@ static void FUNC_PREFIX(draw_quad_rgb15)(const render_primitive *prim, void *dst
 static void FUNC_PREFIX(draw_quad_rgb32)(const render_primitive *prim, void *dstdata, UINT32 pitch, quad_setup_data *setup)
 {
 	const rgb_t *palbase = prim->texture.palette;
+	const UINT32 *prevrow = NULL;
 	INT32 dudx = setup->dudx;
 	INT32 dvdx = setup->dvdx;
 	INT32 endx = setup->endx;
@@ -1501,6 +1563,69 @@ static void FUNC_PREFIX(draw_quad_rgb32)(const render_primitive *prim, void *dst
 			INT32 curu = setup->startu + (y - setup->starty) * setup->dudy;
 			INT32 curv = setup->startv + (y - setup->starty) * setup->dvdy;
 
+			/* row case: the whole row comes from one row of the texture */
+			if (QUAD_ROW_CASE(dvdx))
+			{
+				const UINT32 *texrow = (const UINT32 *)prim->texture.base + (curv >> 16) * prim->texture.rowpixels;
+				INT32 count = endx - setup->startx;
+
+				/* a row reading the same texels as the one above is a copy of it */
+				if (setup->dudy == 0 && texrow == prevrow)
+				{
+					memcpy(dest, dest - pitch, count * sizeof(*dest));
+					continue;
+				}
+				prevrow = texrow;
+
+				if (palbase == NULL && dudx == 0x10000)
+				{
+					texrow += curu >> 16;
+					for (x = 0; x < count; x++)
+						dest[x] = SOURCE32_TO_DEST(texrow[x]);
+				}
+				else if (palbase == NULL && QUAD_INTEGER_SCALE(curu, dudx))
+				{
+					/* each texel covers a run of 0x10000 / dudx pixels after the first */
+					INT32 run = (0x10000 - (curu & 0xffff) + dudx - 1) / dudx;
+					texrow += curu >> 16;
+					for (x = 0; x < count; texrow++, run = 0x10000 / dudx)
+					{
+						PIXEL_TYPE pix = SOURCE32_TO_DEST(*texrow);
+						INT32 end = MIN(x + run, count);
+						while (x < end)
+							dest[x++] = pix;
+					}
+				}
+				else if (palbase == NULL)
+				{
+					for (x = 0; x < count; x++, curu += dudx)
+						dest[x] = SOURCE32_TO_DEST(texrow[curu >> 16]);
+				}
+				else
+				{
+					/* the lookups are the cost here, so a texel that repeats the one
+					   before it (scaling up, or a flat area) reuses its result */
+					UINT32 lastpix = ~texrow[curu >> 16];
+					PIXEL_TYPE lastdest = 0;
+
+					for (x = 0; x < count; x++, curu += dudx)
+					{
+						UINT32 pix = texrow[curu >> 16];
+						if (pix != lastpix)
+						{
+							UINT32 r = palbase[(pix >> 16) & 0xff] >> SRCSHIFT_R;
+							UINT32 g = palbase[(pix >> 8) & 0xff] >> SRCSHIFT_G;
+							UINT32 b = palbase[(pix >> 0) & 0xff] >> SRCSHIFT_B;
+
+							lastdest = DEST_ASSEMBLE_RGB(r, g, b);
+							lastpix = pix;
+						}
+						dest[x] = lastdest;
+					}
+				}
+				continue;
+			}
+
 			/* no lookup case */
 			if (palbase == NULL)
 			{
@@ -1811,6 +1936,28 @@ static void FUNC_PREFIX(draw_quad_argb32_alpha)(const render_primitive *prim, vo
 			INT32 curu = setup->startu + (y - setup->starty) * setup->dudy;
 			INT32 curv = setup->startv + (y - setup->starty) * setup->dvdy;
 
+			/* row case: the whole row comes from one row of the texture; blends
+			   every pixel and selects, so only where reading the dest is cheap */
+			if (!NO_DEST_READ && palbase == NULL && QUAD_ROW_CASE(dvdx))
+			{
+				const UINT32 *texrow = (const UINT32 *)prim->texture.base + (curv >> 16) * prim->texture.rowpixels;
+				INT32 count = endx - setup->startx;
+
+				for (x = 0; x < count; x++, curu += dudx)
+				{
+					UINT32 pix = texrow[curu >> 16];
+					UINT32 ta = pix >> 24;
+					UINT32 dpix = dest[x];
+					UINT32 invta = 0x100 - ta;
+					UINT32 r = (SOURCE32_R(pix) * ta + DEST_R(dpix) * invta) >> 8;
+					UINT32 g = (SOURCE32_G(pix) * ta + DEST_G(dpix) * invta) >> 8;
+					UINT32 b = (SOURCE32_B(pix) * ta + DEST_B(dpix) * invta) >> 8;
+
+					dest[x] = (ta != 0) ? DEST_ASSEMBLE_RGB(r, g, b) : dpix;
+				}
+				continue;
+			}
+
 			/* no lookup case */
 			if (palbase == NULL)
 			{
@@ -2220,7 +2367,7 @@ static void FUNC_PREFIX(draw_quad_argb32_add)(const render_primitive *prim, void
     drawing routine
 -------------------------------------------------*/
 
-static void FUNC_PREFIX(setup_and_draw_textured_quad)(const render_primitive *prim, void *dstdata, INT32 width, INT32 height, UINT32 pitch)
+static void FUNC_PREFIX(setup_and_draw_textured_quad)(const render_primitive *prim, void *dstdata, INT32 width, INT32 height, UINT32 pitch, const rectangle *clip)
 {
 	float fdudx, fdvdx, fdudy, fdvdy;
 	quad_setup_data setup;
@@ -2269,6 +2416,19 @@ static void FUNC_PREFIX(setup_and_draw_textured_quad)(const render_primitive *pr
 		setup.startv -= 0x8000;
 	}
 
+	/* apply the caller's clip, stepping u/v to the new start so every pixel comes out as it would unclipped */
+	if (clip != NULL)
+	{
+		INT32 skipx = MAX(clip->min_x - setup.startx, 0);
+		INT32 skipy = MAX(clip->min_y - setup.starty, 0);
+		setup.startu += skipx * setup.dudx + skipy * setup.dudy;
+		setup.startv += skipx * setup.dvdx + skipy * setup.dvdy;
+		setup.startx += skipx;
+		setup.starty += skipy;
+		setup.endx = MIN(setup.endx, clip->max_x + 1);
+		setup.endy = MIN(setup.endy, clip->max_y + 1);
+	}
+
 	/* render based on the texture coordinates */
 	switch (prim->flags & (PRIMFLAG_TEXFORMAT_MASK | PRIMFLAG_BLENDMODE_MASK))
 	{
@@ -2330,10 +2490,13 @@ static void FUNC_PREFIX(setup_and_draw_textured_quad)(const render_primitive *pr
 
 /*-------------------------------------------------
     draw_primitives - draw a series of primitives
-    using a software rasterizer
+    using a software rasterizer; if clip is not
+    NULL, only pixels within it are touched (lines
+    are never clipped, so callers must redraw
+    everything when there are any)
 -------------------------------------------------*/
 
-static void FUNC_PREFIX(draw_primitives)(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch)
+static void FUNC_PREFIX(draw_primitives)(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, const rectangle *clip)
 {
 	const render_primitive *prim;
 
@@ -2347,9 +2510,9 @@ static void FUNC_PREFIX(draw_primitives)(const render_primitive_list &primlist,
 
 			case render_primitive::QUAD:
 				if (!prim->texture.base)
-					FUNC_PREFIX(draw_rect)(prim, dstdata, width, height, pitch);
+					FUNC_PREFIX(draw_rect)(prim, dstdata, width, height, pitch, clip);
 				else
-					FUNC_PREFIX(setup_and_draw_textured_quad)(prim, dstdata, width, height, pitch);
+					FUNC_PREFIX(setup_and_draw_textured_quad)(prim, dstdata, width, height, pitch, clip);
 				break;
 
 			default:
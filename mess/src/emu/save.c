@@ -49,6 +49,21 @@
     Data is always written as native-endian.
     Data is converted from the endiannness it was written upon load.
 
+    Rewind history:
+
+    When enabled, each frame the registered entries are flattened into
+    a snapshot in memory. Only the most recent snapshot is kept whole;
+    for older ones a ring holds the XOR of each snapshot with the one
+    after it, run-length encoded as pairs of
+
+        varint  number of unchanged bytes to skip
+        varint  number of changed bytes that follow
+        ...     the changed bytes, XORed with the newer snapshot
+
+    Rewinding N frames XORs the newest N deltas back into the current
+    snapshot and copies it out to the entries, so its cost depends on
+    how much changed, not on the size of the state.
+
 ***************************************************************************/
 
 #include "emu.h"
@@ -73,6 +88,9 @@
 const int SAVE_VERSION		= 2;
 const int HEADER_SIZE		= 32;
 
+// unchanged runs shorter than this are folded into the surrounding changes
+const int REWIND_MIN_SKIP	= 4;
+
 // Available flags
 enum
 {
@@ -99,6 +117,15 @@ save_manager::save_manager(running_machine &machine)
 	: m_machine(machine),
 	  m_reg_allowed(true),
 	  m_illegal_regs(0),
+	  m_rewind_size(0),
+	  m_rewind_state(NULL),
+	  m_rewind_scratch(NULL),
+	  m_rewind_delta(NULL),
+	  m_rewind_ring(NULL),
+	  m_rewind_depth(0),
+	  m_rewind_head(0),
+	  m_rewind_count(0),
+	  m_rewind_valid(false),
 	  m_entry_list(machine.respool()),
 	  m_presave_list(machine.respool()),
 	  m_postload_list(machine.respool())
@@ -113,10 +140,13 @@ save_manager::save_manager(running_machine &machine)
 
 void save_manager::allow_registration(bool allowed)
 {
-	// allow/deny registration
+	// allow/deny registration; entries are kept in name order once it closes
 	m_reg_allowed = allowed;
 	if (!allowed)
+	{
+		sort_entries();
 		dump_registry();
+	}
 }
 
 
@@ -207,22 +237,39 @@ void save_manager::save_memory(const char *module, const char *tag, UINT32 index
 	else
 		totalname.printf("%s/%X/%s", module, index, name);
 
-	// look for duplicates and an entry to insert in front of
-	state_entry *insert_after = NULL;
-	for (state_entry *entry = m_entry_list.first(); entry != NULL; entry = entry->next())
-	{
-		// stop when we find an entry whose name is after ours
-		if (entry->m_name > totalname)
-			break;
-		insert_after = entry;
+	// error if we are a duplicate
+	state_entry &entry = *auto_alloc(machine(), state_entry(val, totalname, valsize, valcount));
+	if (m_entry_map.add(entry.m_name, &entry) == TMERR_DUPLICATE)
+		fatalerror("Duplicate save state registration entry (%s)", totalname.cstr());
 
-		// error if we are equal
-		if (entry->m_name == totalname)
-			fatalerror("Duplicate save state registration entry (%s)", totalname.cstr());
-	}
+	// append us to the list; it gets sorted when registration closes
+	m_entry_list.append(entry);
+}
+
+
+//-------------------------------------------------
+//  sort_entries - sort the registered entries by
+//  name, which fixes their order in the save data
+//-------------------------------------------------
+
+void save_manager::sort_entries()
+{
+	int count = m_entry_list.count();
+	if (count == 0)
+		return;
 
-	// insert us into the list
-	m_entry_list.insert_after(*auto_alloc(machine(), state_entry(val, totalname, valsize, valcount)), insert_after);
+	// gather the entries into an array and sort it
+	state_entry **entries = global_alloc_array(state_entry *, count);
+	int index = 0;
+	for (state_entry *entry = m_entry_list.first(); entry != NULL; entry = entry->next())
+		entries[index++] = entry;
+	qsort(entries, count, sizeof(entries[0]), state_entry::compare);
+
+	// rebuild the list in sorted order
+	m_entry_list.detach_all();
+	for (index = 0; index < count; index++)
+		m_entry_list.append(*entries[index]);
+	global_free(entries);
 }
 
 
@@ -340,6 +387,127 @@ save_error save_manager::write_file(emu_file &file)
 }
 
 
+//-------------------------------------------------
+//  rewind_init - allocate the buffers for an
+//  in-memory history of the given depth
+//-------------------------------------------------
+
+void save_manager::rewind_init(int depth)
+{
+	// only possible once the entries are final
+	assert(!m_reg_allowed);
+	if (depth <= 0 || m_illegal_regs > 0)
+		return;
+
+	// lay out the entries back to back in a flat snapshot
+	m_rewind_size = 0;
+	for (state_entry *entry = m_entry_list.first(); entry != NULL; entry = entry->next())
+	{
+		entry->m_offset = m_rewind_size;
+		m_rewind_size += entry->m_typesize * entry->m_typecount;
+	}
+
+	// a delta is at worst twice the size of the data it covers, plus a few bytes of slop
+	m_rewind_state = auto_alloc_array_clear(machine(), UINT8, m_rewind_size);
+	m_rewind_scratch = auto_alloc_array_clear(machine(), UINT8, m_rewind_size);
+	m_rewind_delta = auto_alloc_array(machine(), UINT8, 2 * m_rewind_size + 16);
+
+	// the ring slots grow to fit the largest delta they have held
+	m_rewind_ring = auto_alloc_array_clear(machine(), rewind_slot, depth);
+	m_rewind_depth = depth;
+	m_rewind_head = 0;
+	m_rewind_count = 0;
+	m_rewind_valid = false;
+}
+
+
+//-------------------------------------------------
+//  rewind_capture - add a snapshot of the current
+//  state to the rewind history
+//-------------------------------------------------
+
+save_error save_manager::rewind_capture()
+{
+	// if we have illegal registrations, return an error
+	if (m_illegal_regs > 0)
+		return STATERR_ILLEGAL_REGISTRATIONS;
+	if (m_rewind_depth == 0)
+		return STATERR_NO_HISTORY;
+
+	// call the pre-save functions
+	for (state_callback *func = m_presave_list.first(); func != NULL; func = func->next())
+		func->m_func();
+
+	// flatten all the data into the scratch snapshot
+	for (state_entry *entry = m_entry_list.first(); entry != NULL; entry = entry->next())
+		memcpy(&m_rewind_scratch[entry->m_offset], entry->m_data, entry->m_typesize * entry->m_typecount);
+
+	// if there is a previous snapshot, record how to get back to it
+	if (m_rewind_valid)
+	{
+		UINT32 length = rewind_encode(m_rewind_delta, m_rewind_scratch, m_rewind_state, m_rewind_size);
+
+		// advance the head, overwriting the oldest delta if the ring is full
+		m_rewind_head = (m_rewind_head + 1) % m_rewind_depth;
+		if (m_rewind_count < m_rewind_depth)
+			m_rewind_count++;
+
+		// grow the slot if needed, and copy the delta in
+		rewind_slot &slot = m_rewind_ring[m_rewind_head];
+		if (slot.m_alloc < length)
+		{
+			auto_free(machine(), slot.m_data);
+			slot.m_alloc = length + length / 4;
+			slot.m_data = auto_alloc_array(machine(), UINT8, slot.m_alloc);
+		}
+		memcpy(slot.m_data, m_rewind_delta, length);
+		slot.m_length = length;
+	}
+
+	// the scratch snapshot becomes the current one
+	UINT8 *temp = m_rewind_state;
+	m_rewind_state = m_rewind_scratch;
+	m_rewind_scratch = temp;
+	m_rewind_valid = true;
+	return STATERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  rewind_restore - restore the state as of the
+//  given number of snapshots before the most
+//  recent one, discarding the newer ones
+//-------------------------------------------------
+
+save_error save_manager::rewind_restore(int steps)
+{
+	// if we have illegal registrations, return an error
+	if (m_illegal_regs > 0)
+		return STATERR_ILLEGAL_REGISTRATIONS;
+	if (!m_rewind_valid || steps < 0 || steps > m_rewind_count)
+		return STATERR_NO_HISTORY;
+
+	// undo the newest deltas one by one
+	for ( ; steps > 0; steps--)
+	{
+		const rewind_slot &slot = m_rewind_ring[m_rewind_head];
+		rewind_decode(m_rewind_state, slot.m_data, slot.m_length);
+		m_rewind_head = (m_rewind_head + m_rewind_depth - 1) % m_rewind_depth;
+		m_rewind_count--;
+	}
+
+	// copy the snapshot back out
+	for (state_entry *entry = m_entry_list.first(); entry != NULL; entry = entry->next())
+		memcpy(entry->m_data, &m_rewind_state[entry->m_offset], entry->m_typesize * entry->m_typecount);
+
+	// call the post-load functions
+	for (state_callback *func = m_postload_list.first(); func != NULL; func = func->next())
+		func->m_func();
+
+	return STATERR_NONE;
+}
+
+
 //-------------------------------------------------
 //  signature - compute the signature, which
 //  is a CRC over the structure of the data
@@ -376,6 +544,102 @@ void save_manager::dump_registry() const
 }
 
 
+//-------------------------------------------------
+//  rewind_encode - encode the XOR of two
+//  snapshots as skip/literal runs; returns the
+//  number of bytes written
+//-------------------------------------------------
+
+static inline UINT8 *rewind_put_varint(UINT8 *dest, UINT32 value)
+{
+	while (value >= 0x80)
+	{
+		*dest++ = (value & 0x7f) | 0x80;
+		value >>= 7;
+	}
+	*dest++ = value;
+	return dest;
+}
+
+UINT32 save_manager::rewind_encode(UINT8 *dest, const UINT8 *curdata, const UINT8 *prevdata, UINT32 length)
+{
+	UINT8 *start = dest;
+	UINT32 pos = 0;
+
+	while (pos < length)
+	{
+		// skip unchanged bytes, a word at a time once aligned
+		UINT32 skipstart = pos;
+		while (pos < length && (pos & 3) != 0 && curdata[pos] == prevdata[pos])
+			pos++;
+		if ((pos & 3) == 0)
+			while (pos + 4 <= length && *(const UINT32 *)&curdata[pos] == *(const UINT32 *)&prevdata[pos])
+				pos += 4;
+		while (pos < length && curdata[pos] == prevdata[pos])
+			pos++;
+		if (pos == length)
+			break;
+		UINT32 skip = pos - skipstart;
+
+		// gather changed bytes, absorbing short unchanged runs
+		UINT32 litstart = pos;
+		while (pos < length)
+		{
+			if (curdata[pos] != prevdata[pos])
+			{
+				pos++;
+				continue;
+			}
+			UINT32 run = 0;
+			while (run < REWIND_MIN_SKIP && pos + run < length && curdata[pos + run] == prevdata[pos + run])
+				run++;
+			if (run == REWIND_MIN_SKIP || pos + run == length)
+				break;
+			pos += run;
+		}
+
+		// emit the pair and the XORed bytes
+		dest = rewind_put_varint(dest, skip);
+		dest = rewind_put_varint(dest, pos - litstart);
+		for (UINT32 index = litstart; index < pos; index++)
+			*dest++ = curdata[index] ^ prevdata[index];
+	}
+	return dest - start;
+}
+
+
+//-------------------------------------------------
+//  rewind_decode - XOR an encoded delta into a
+//  snapshot
+//-------------------------------------------------
+
+static inline const UINT8 *rewind_get_varint(const UINT8 *src, UINT32 &value)
+{
+	value = 0;
+	for (int shift = 0; ; shift += 7)
+	{
+		UINT8 data = *src++;
+		value |= (data & 0x7f) << shift;
+		if ((data & 0x80) == 0)
+			return src;
+	}
+}
+
+void save_manager::rewind_decode(UINT8 *dest, const UINT8 *delta, UINT32 length)
+{
+	const UINT8 *end = delta + length;
+	while (delta < end)
+	{
+		UINT32 skip, count;
+		delta = rewind_get_varint(delta, skip);
+		delta = rewind_get_varint(delta, count);
+		dest += skip;
+		while (count-- != 0)
+			*dest++ ^= *delta++;
+	}
+}
+
+
 //-------------------------------------------------
 //  validate_header - validate the data in the
 //  header
@@ -449,6 +713,19 @@ save_manager::state_entry::state_entry(void *data, const char *name, UINT8 size,
 }
 
 
+//-------------------------------------------------
+//  compare - qsort callback to order entries by
+//  name
+//-------------------------------------------------
+
+int CLIB_DECL save_manager::state_entry::compare(const void *item1, const void *item2)
+{
+	const state_entry *entry1 = *reinterpret_cast<const state_entry * const *>(item1);
+	const state_entry *entry2 = *reinterpret_cast<const state_entry * const *>(item2);
+	return entry1->m_name.cmp(entry2->m_name);
+}
+
+
 //-------------------------------------------------
 //  flip_data - reverse the endianness of a
 //  block of  data
@@ -58,7 +58,8 @@ enum save_error
 	STATERR_ILLEGAL_REGISTRATIONS,
 	STATERR_INVALID_HEADER,
 	STATERR_READ_ERROR,
-	STATERR_WRITE_ERROR
+	STATERR_WRITE_ERROR,
+	STATERR_NO_HISTORY
 };
 
 
@@ -188,9 +189,19 @@ public:
 	save_error write_file(emu_file &file);
 	save_error read_file(emu_file &file);
 
+	// in-memory rewind history
+	void rewind_init(int depth);
+	int rewind_depth() const { return m_rewind_depth; }
+	int rewind_count() const { return m_rewind_count; }
+	save_error rewind_capture();
+	save_error rewind_restore(int steps);
+
 private:
 	// internal helpers
 	UINT32 signature() const;
+	void sort_entries();
+	static UINT32 rewind_encode(UINT8 *dest, const UINT8 *curdata, const UINT8 *prevdata, UINT32 length);
+	static void rewind_decode(UINT8 *dest, const UINT8 *delta, UINT32 length);
 	void dump_registry() const;
 	static save_error validate_header(const UINT8 *header, const char *gamename, UINT32 signature, void (CLIB_DECL *errormsg)(const char *fmt, ...), const char *error_prefix);
 
@@ -220,6 +231,7 @@ private:
 
 		// helpers
 		void flip_data();
+		static int CLIB_DECL compare(const void *item1, const void *item2);
 
 		// state
 		state_entry *		m_next;					// pointer to next entry
@@ -230,12 +242,33 @@ private:
 		UINT32				m_offset;				// offset within the final structure
 	};
 
+	// rewind_slot holds one delta in the rewind ring
+	class rewind_slot
+	{
+	public:
+		UINT8 *				m_data;					// encoded delta
+		UINT32				m_length;				// length of the encoded delta
+		UINT32				m_alloc;				// bytes allocated for m_data
+	};
+
 	// internal state
 	running_machine &		m_machine;				// reference to our machine
 	bool					m_reg_allowed;			// are registrations allowed?
 	int						m_illegal_regs;			// number of illegal registrations
 
+	// rewind state
+	UINT32					m_rewind_size;			// size of a flattened snapshot
+	UINT8 *					m_rewind_state;			// most recent snapshot
+	UINT8 *					m_rewind_scratch;		// scratch snapshot being captured
+	UINT8 *					m_rewind_delta;			// scratch buffer for encoding deltas
+	rewind_slot *			m_rewind_ring;			// ring of deltas back to older snapshots
+	int						m_rewind_depth;			// number of slots in the ring
+	int						m_rewind_head;			// slot holding the newest delta
+	int						m_rewind_count;			// number of valid deltas in the ring
+	bool					m_rewind_valid;			// has a snapshot been captured?
+
 	simple_list<state_entry> m_entry_list;			// list of reigstered entries
+	tagmap_t<state_entry *>	m_entry_map;			// map of registered entries by name
 	simple_list<state_callback> m_presave_list;		// list of pre-save functions
 	simple_list<state_callback> m_postload_list;	// list of post-load functions
 
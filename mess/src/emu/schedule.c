@@ -78,6 +78,8 @@ emu_timer::emu_timer()
 	: m_machine(NULL),
 	  m_next(NULL),
 	  m_prev(NULL),
+	  m_heapindex(-1),
+	  m_ordinal(0),
 	  m_param(0),
 	  m_ptr(NULL),
 	  m_enabled(false),
@@ -111,6 +113,7 @@ emu_timer &emu_timer::init(running_machine &machine, timer_expired_delegate call
 	m_machine = &machine;
 	m_next = NULL;
 	m_prev = NULL;
+	m_heapindex = -1;
 	m_callback = callback;
 	m_param = 0;
 	m_ptr = ptr;
@@ -143,6 +146,7 @@ emu_timer &emu_timer::init(device_t &device, device_timer_id id, void *ptr, bool
 	m_machine = &device.machine();
 	m_next = NULL;
 	m_prev = NULL;
+	m_heapindex = -1;
 	m_callback = timer_expired_delegate();
 	m_param = 0;
 	m_ptr = ptr;
@@ -190,9 +194,8 @@ bool emu_timer::enable(bool enable)
 		// set the enable flag
 		m_enabled = enable;
 
-		// remove the timer and insert back into the list
-		machine().scheduler().timer_list_remove(*this);
-		machine().scheduler().timer_list_insert(*this);
+		// add or remove the timer from the active set
+		machine().scheduler().timer_reschedule(*this);
 	}
 	return old;
 }
@@ -224,12 +227,11 @@ void emu_timer::adjust(attotime start_delay, INT32 param, attotime period)
 	m_expire = m_start + start_delay;
 	m_period = period;
 
-	// remove and re-insert the timer in its new order
-	scheduler.timer_list_remove(*this);
-	scheduler.timer_list_insert(*this);
+	// move the timer to its new place in the active set
+	scheduler.timer_reschedule(*this);
 
-	// if this was inserted as the head, abort the current timeslice and resync
-	if (this == scheduler.first_timer())
+	// if this is now the next timer to fire, abort the current timeslice and resync
+	if (this == &scheduler.next_timer())
 		scheduler.abort_timeslice();
 }
 
@@ -305,10 +307,8 @@ void emu_timer::schedule_next_period()
 	m_start = m_expire;
 	m_expire += m_period;
 
-	// remove and re-insert us
-	device_scheduler &scheduler = machine().scheduler();
-	scheduler.timer_list_remove(*this);
-	scheduler.timer_list_insert(*this);
+	// move us to our new place in the active set
+	machine().scheduler().timer_reschedule(*this);
 }
 
 
@@ -342,6 +342,10 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_execute_list(NULL),
 	m_basetime(attotime::zero),
 	m_timer_list(NULL),
+	m_timer_heap(NULL),
+	m_timer_heap_count(0),
+	m_timer_heap_alloc(0),
+	m_timer_ordinal(0),
 	m_timer_allocator(machine.respool()),
 	m_callback_timer(NULL),
 	m_callback_timer_modified(false),
@@ -350,9 +354,12 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_quantum_allocator(machine.respool()),
 	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
 {
-	// append a single never-expiring timer so there is always one in the list
-	m_timer_list = &m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), NULL, true);
-	m_timer_list->adjust(attotime::never);
+	// start with enough heap space for a typical machine; it grows as needed
+	m_timer_heap_alloc = 64;
+	m_timer_heap = auto_alloc_array(machine, emu_timer *, m_timer_heap_alloc);
+
+	// append a single never-expiring timer so there is always one active
+	m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), NULL, true).adjust(attotime::never);
 
 	// register global states
 	machine.save().save_item(NAME(m_basetime));
@@ -397,19 +404,32 @@ attotime device_scheduler::time() const
 bool device_scheduler::can_save() const
 {
 	// if any live temporary timers exit, fail
-	for (emu_timer *timer = m_timer_list; timer != NULL; timer = timer->next())
-		if (timer->m_temporary && timer->expire() != attotime::never)
-		{
-			logerror("Failed save state attempt due to anonymous timers:\n");
-			dump_timers();
-			return false;
-		}
+	if (anonymous_timers_pending())
+	{
+		logerror("Failed save state attempt due to anonymous timers:\n");
+		dump_timers();
+		return false;
+	}
 
 	// otherwise, we're good
 	return true;
 }
 
 
+//-------------------------------------------------
+//  anonymous_timers_pending - return true if any
+//  live temporary timers exist, without logging
+//-------------------------------------------------
+
+bool device_scheduler::anonymous_timers_pending() const
+{
+	for (emu_timer *timer = m_timer_list; timer != NULL; timer = timer->next())
+		if (timer->m_temporary && timer->expire() != attotime::never)
+			return true;
+	return false;
+}
+
+
 //-------------------------------------------------
 //  timeslice - execute all devices for a single
 //  timeslice
@@ -427,14 +447,14 @@ void device_scheduler::timeslice()
 	execute_timers();
 
 	// loop until we hit the next timer
-	while (m_basetime < m_timer_list->m_expire)
+	while (m_basetime < next_timer().m_expire)
 	{
 		// by default, assume our target is the end of the next quantum
 		attotime target = m_basetime + attotime(0, m_quantum_list.first()->m_actual);
 
 		// however, if the next timer is going to fire before then, override
-		if (m_timer_list->m_expire < target)
-			target = m_timer_list->m_expire;
+		if (next_timer().m_expire < target)
+			target = next_timer().m_expire;
 
 		LOG(("------------------\n"));
 		LOG(("cpu_timeslice: target = %s\n", target.as_string()));
@@ -685,7 +705,7 @@ void device_scheduler::postload()
 			private_list.append(timer_list_remove(timer));
 	}
 
-	// now re-insert them; this effectively re-sorts them by time
+	// now re-insert them; this rebuilds the heap from the loaded times
 	emu_timer *timer;
 	while ((timer = private_list.detach_head()) != NULL)
 		timer_list_insert(*timer);
@@ -810,55 +830,39 @@ void device_scheduler::rebuild_execute_list()
 
 
 //-------------------------------------------------
-//  timer_list_insert - insert a new timer into
-//  the list at the appropriate location
+//  timer_list_insert - add a new timer to the
+//  list of all timers, and to the active heap
+//  if it is enabled
 //-------------------------------------------------
 
 emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 {
-	// disabled timers sort to the end
-	attotime expire = timer.m_enabled ? timer.m_expire : attotime::never;
-
-	// loop over the timer list
-	emu_timer *prevtimer = NULL;
-	for (emu_timer *curtimer = m_timer_list; curtimer != NULL; prevtimer = curtimer, curtimer = curtimer->next())
-	{
-		// if the current list entry expires after us, we should be inserted before it
-		if (curtimer->m_expire > expire)
-		{
-			// link the new guy in before the current list entry
-			timer.m_prev = curtimer->m_prev;
-			timer.m_next = curtimer;
-
-			if (curtimer->m_prev != NULL)
-				curtimer->m_prev->m_next = &timer;
-			else
-				m_timer_list = &timer;
-
-			curtimer->m_prev = &timer;
-			return timer;
-		}
-	}
-
-	// need to insert after the last one
-	if (prevtimer != NULL)
-		prevtimer->m_next = &timer;
-	else
-		m_timer_list = &timer;
-
-	timer.m_prev = prevtimer;
-	timer.m_next = NULL;
+	// the list of all timers is unordered, so just link in at the head
+	timer.m_prev = NULL;
+	timer.m_next = m_timer_list;
+	if (m_timer_list != NULL)
+		m_timer_list->m_prev = &timer;
+	m_timer_list = &timer;
+
+	// disabled timers never fire, so they stay out of the heap
+	timer.m_heapindex = -1;
+	if (timer.m_enabled)
+		timer_heap_insert(timer);
 	return timer;
 }
 
 
 //-------------------------------------------------
 //  timer_list_remove - remove a timer from the
-//  linked list
+//  list of all timers and the active heap
 //-------------------------------------------------
 
 emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 {
+	// remove it from the heap
+	if (timer.m_heapindex >= 0)
+		timer_heap_remove(timer);
+
 	// remove it from the list
 	if (timer.m_prev != NULL)
 		timer.m_prev->m_next = timer.m_next;
@@ -872,6 +876,145 @@ emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 }
 
 
+//-------------------------------------------------
+//  timer_reschedule - move a timer to its place
+//  in the active heap after its expiration time
+//  or enable state has changed
+//-------------------------------------------------
+
+void device_scheduler::timer_reschedule(emu_timer &timer)
+{
+	// disabled timers leave the heap
+	if (!timer.m_enabled)
+	{
+		if (timer.m_heapindex >= 0)
+			timer_heap_remove(timer);
+	}
+
+	// newly enabled timers join it
+	else if (timer.m_heapindex < 0)
+		timer_heap_insert(timer);
+
+	// otherwise, it sorts after any timers already scheduled for the same
+	// time, and moves up or down from where it is
+	else
+	{
+		timer.m_ordinal = m_timer_ordinal++;
+		timer_heap_sift_up(timer.m_heapindex);
+		timer_heap_sift_down(timer.m_heapindex);
+	}
+}
+
+
+//-------------------------------------------------
+//  timer_heap_insert - add a timer to the heap
+//  of active timers
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_insert(emu_timer &timer)
+{
+	assert(timer.m_heapindex < 0);
+
+	// grow the heap if we need to
+	if (m_timer_heap_count == m_timer_heap_alloc)
+	{
+		emu_timer **newheap = auto_alloc_array(machine(), emu_timer *, m_timer_heap_alloc * 2);
+		memcpy(newheap, m_timer_heap, m_timer_heap_count * sizeof(m_timer_heap[0]));
+		auto_free(machine(), m_timer_heap);
+		m_timer_heap = newheap;
+		m_timer_heap_alloc *= 2;
+	}
+
+	// add at the bottom and let it bubble up
+	timer.m_ordinal = m_timer_ordinal++;
+	timer_heap_place(timer, m_timer_heap_count++);
+	timer_heap_sift_up(timer.m_heapindex);
+}
+
+
+//-------------------------------------------------
+//  timer_heap_remove - remove a timer from the
+//  heap of active timers
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_remove(emu_timer &timer)
+{
+	int index = timer.m_heapindex;
+	assert(index >= 0 && index < m_timer_heap_count && m_timer_heap[index] == &timer);
+	timer.m_heapindex = -1;
+
+	// fill the hole with the last timer and move that to its place
+	emu_timer &last = *m_timer_heap[--m_timer_heap_count];
+	if (&last != &timer)
+	{
+		timer_heap_place(last, index);
+		timer_heap_sift_up(index);
+		timer_heap_sift_down(last.m_heapindex);
+	}
+}
+
+
+//-------------------------------------------------
+//  timer_heap_place - store a timer at a given
+//  index in the heap
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_place(emu_timer &timer, int index)
+{
+	m_timer_heap[index] = &timer;
+	timer.m_heapindex = index;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_up - move the timer at the
+//  given index toward the top of the heap until
+//  its parent fires before it
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_sift_up(int index)
+{
+	emu_timer &timer = *m_timer_heap[index];
+	while (index > 0)
+	{
+		int parent = (index - 1) / 2;
+		if (!timer_heap_before(timer, *m_timer_heap[parent]))
+			break;
+		timer_heap_place(*m_timer_heap[parent], index);
+		index = parent;
+	}
+	timer_heap_place(timer, index);
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_down - move the timer at the
+//  given index toward the bottom of the heap
+//  until both children fire after it
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_sift_down(int index)
+{
+	emu_timer &timer = *m_timer_heap[index];
+	while (true)
+	{
+		// pick the earlier of the two children
+		int child = 2 * index + 1;
+		if (child >= m_timer_heap_count)
+			break;
+		if (child + 1 < m_timer_heap_count && timer_heap_before(*m_timer_heap[child + 1], *m_timer_heap[child]))
+			child++;
+
+		// stop once we fire no later than it
+		if (!timer_heap_before(*m_timer_heap[child], timer))
+			break;
+		timer_heap_place(*m_timer_heap[child], index);
+		index = child;
+	}
+	timer_heap_place(timer, index);
+}
+
+
 //-------------------------------------------------
 //  execute_timers - execute timers and update
 //  scheduling quanta
@@ -883,13 +1026,13 @@ void device_scheduler::execute_timers()
 	while (m_basetime >= m_quantum_list.first()->m_expire)
 		m_quantum_allocator.reclaim(m_quantum_list.detach_head());
 
-	LOG(("timer_set_global_time: new=%s head->expire=%s\n", m_basetime.as_string(), m_timer_list->m_expire.as_string()));
+	LOG(("timer_set_global_time: new=%s head->expire=%s\n", m_basetime.as_string(), next_timer().m_expire.as_string()));
 
 	// now process any timers that are overdue
-	while (m_timer_list->m_expire <= m_basetime)
+	while (next_timer().m_expire <= m_basetime)
 	{
 		// if this is a one-shot timer, disable it now
-		emu_timer &timer = *m_timer_list;
+		emu_timer &timer = next_timer();
 		bool was_enabled = timer.m_enabled;
 		if (timer.m_period == attotime::zero || timer.m_period == attotime::never)
 			timer.m_enabled = false;
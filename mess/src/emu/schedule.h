@@ -126,8 +126,10 @@ private:
 
 	// internal state
 	running_machine *	m_machine;		// reference to the owning machine
-	emu_timer *			m_next;			// next timer in order in the list
-	emu_timer *			m_prev;			// previous timer in order in the list
+	emu_timer *			m_next;			// next timer in the list of all timers
+	emu_timer *			m_prev;			// previous timer in the list of all timers
+	int					m_heapindex;	// index in the active timer heap, or -1 if not active
+	UINT64				m_ordinal;		// order of scheduling, to keep equal expirations FIFO
 	timer_expired_delegate m_callback;	// callback function
 	INT32				m_param;		// integer parameter
 	void *				m_ptr;			// pointer parameter
@@ -159,6 +161,7 @@ public:
 	emu_timer *first_timer() const { return m_timer_list; }
 	device_execute_interface *currently_executing() const { return m_executing_device; }
 	bool can_save() const;
+	bool anonymous_timers_pending() const;
 
 	// execution
 	void timeslice();
@@ -202,16 +205,33 @@ private:
 	// timer helpers
 	emu_timer &timer_list_insert(emu_timer &timer);
 	emu_timer &timer_list_remove(emu_timer &timer);
+	void timer_reschedule(emu_timer &timer);
 	void execute_timers();
 
+	// active timer heap helpers
+	emu_timer &next_timer() const { return *m_timer_heap[0]; }
+	bool timer_heap_before(const emu_timer &timer1, const emu_timer &timer2) const
+	{
+		return (timer1.m_expire < timer2.m_expire || (timer1.m_expire == timer2.m_expire && timer1.m_ordinal < timer2.m_ordinal));
+	}
+	void timer_heap_insert(emu_timer &timer);
+	void timer_heap_remove(emu_timer &timer);
+	void timer_heap_place(emu_timer &timer, int index);
+	void timer_heap_sift_up(int index);
+	void timer_heap_sift_down(int index);
+
 	// internal state
 	running_machine &			m_machine;					// reference to our machine
 	device_execute_interface *	m_executing_device;			// pointer to currently executing device
 	device_execute_interface *	m_execute_list;				// list of devices to be executed
 	attotime					m_basetime;					// global basetime; everything moves forward from here
 
-	// list of active timers
-	emu_timer *					m_timer_list;				// head of the active list
+	// list of all timers, and a binary min-heap of the enabled ones ordered by expiration
+	emu_timer *					m_timer_list;				// head of the list of all timers
+	emu_timer **				m_timer_heap;				// heap of enabled timers
+	int							m_timer_heap_count;			// number of timers in the heap
+	int							m_timer_heap_alloc;			// number of heap slots allocated
+	UINT64						m_timer_ordinal;			// next scheduling order number
 	fixed_allocator<emu_timer>	m_timer_allocator;			// allocator for timers
 
 	// other internal states
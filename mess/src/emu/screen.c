@@ -93,6 +93,7 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	  m_curtexture(0),
 	  m_texture_format(0),
 	  m_changed(true),
+	  m_can_compare(false),
 	  m_last_partial_scan(0),
 	  m_screen_overlay_bitmap(NULL),
 	  m_frame_period(DEFAULT_FRAME_PERIOD.as_attoseconds()),
@@ -427,6 +428,9 @@ void screen_device::configure(int width, int height, const rectangle &visarea, a
 	m_height = height;
 	m_visarea = visarea;
 
+	// the texture on display no longer matches the visible area
+	m_can_compare = false;
+
 	// reallocate bitmap if necessary
 	realloc_screen_bitmaps();
 
@@ -868,8 +872,11 @@ bool screen_device::update_quads()
 		// only update if empty and not a vector game; otherwise assume the driver did it directly
 		if (m_type != SCREEN_TYPE_VECTOR && (machine().config().m_video_attributes & VIDEO_SELF_RENDER) == 0)
 		{
-			// if we're not skipping the frame and if the screen actually changed, then update the texture
-			if (!machine().video().skip_this_frame() && m_changed)
+			// if we're not skipping the frame and if the screen actually changed, then update the texture;
+			// the pixels are only compared when the OSD will make use of the dirty rectangle
+			rectangle dirty;
+			bool compare = m_can_compare && machine().render().dirty_tracking();
+			if (!machine().video().skip_this_frame() && m_changed && (!compare || find_changes(m_visarea, dirty)))
 			{
 				rectangle fixedvis = m_visarea;
 				fixedvis.max_x++;
@@ -878,8 +885,13 @@ bool screen_device::update_quads()
 				palette_t *palette = (m_texture_format == TEXFORMAT_PALETTE16) ? machine().palette : NULL;
 				m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], &fixedvis, m_texture_format, palette);
 
+				// tell the renderer how the new frame differs from the one on display
+				if (compare)
+					m_texture[m_curbitmap]->set_dirty(*m_texture[m_curtexture], dirty);
+
 				m_curtexture = m_curbitmap;
 				m_curbitmap = 1 - m_curbitmap;
+				m_can_compare = true;
 			}
 
 			// create an empty container with a single quad
@@ -895,6 +907,62 @@ bool screen_device::update_quads()
 }
 
 
+//-------------------------------------------------
+//  find_changes - compare the bitmap being drawn
+//  with the one on display over the given area,
+//  returning false if they are identical or true
+//  and the bounds of the differences if not
+//
+//  The bands passed to update_partial can't stand
+//  in for this: drivers redraw every band they
+//  are given whether it changed or not, only a
+//  whole frame can report UPDATE_HAS_NOT_CHANGED,
+//  and wherever the driver leaves the bitmap
+//  being drawn alone it still holds the picture
+//  from two updates back, so only the pixels say
+//  what differs from the display. The compare
+//  costs 2-12us a frame on a 64-bit host (gb at
+//  the low end, a 720x350 MDA screen at the high
+//  end), where just writing a 640x480 32bpp
+//  target once takes 75us.
+//-------------------------------------------------
+
+bool screen_device::find_changes(const rectangle &area, rectangle &dirty) const
+{
+	const bitmap_t &newbitmap = *m_bitmap[m_curbitmap];
+	const bitmap_t &oldbitmap = *m_bitmap[m_curtexture];
+	int bytespp = newbitmap.bpp / 8;
+	int rowbytes = (area.max_x + 1 - area.min_x) * bytespp;
+
+	dirty.min_x = area.max_x + 1;
+	dirty.max_x = area.min_x - 1;
+	dirty.min_y = area.max_y + 1;
+	dirty.max_y = area.min_y - 1;
+
+	// rows that match are skipped by a plain compare; the rest are scanned from each end
+	for (int y = area.min_y; y <= area.max_y; y++)
+	{
+		const UINT8 *newrow = (const UINT8 *)newbitmap.base + (y * newbitmap.rowpixels + area.min_x) * bytespp;
+		const UINT8 *oldrow = (const UINT8 *)oldbitmap.base + (y * oldbitmap.rowpixels + area.min_x) * bytespp;
+		if (memcmp(newrow, oldrow, rowbytes) == 0)
+			continue;
+
+		int left = 0, right = rowbytes - 1;
+		while (newrow[left] == oldrow[left])
+			left++;
+		while (newrow[right] == oldrow[right])
+			right--;
+
+		dirty.min_x = MIN(dirty.min_x, area.min_x + left / bytespp);
+		dirty.max_x = MAX(dirty.max_x, area.min_x + right / bytespp);
+		if (dirty.min_y > y)
+			dirty.min_y = y;
+		dirty.max_y = y;
+	}
+	return (dirty.min_y <= dirty.max_y);
+}
+
+
 //-------------------------------------------------
 //  update_burnin - update the burnin bitmap
 //-------------------------------------------------
@@ -169,6 +169,7 @@ private:
 	// internal helpers
 	void set_container(render_container &container) { m_container = &container; }
 	void realloc_screen_bitmaps();
+	bool find_changes(const rectangle &area, rectangle &dirty) const;
 
 	static TIMER_CALLBACK( static_vblank_begin_callback ) { reinterpret_cast<screen_device *>(ptr)->vblank_begin_callback(); }
 	void vblank_begin_callback();
@@ -214,6 +215,7 @@ private:
 	UINT8				m_curtexture;				// current texture index
 	INT32				m_texture_format;			// texture format of bitmap for this screen
 	bool				m_changed;					// has this bitmap changed?
+	bool				m_can_compare;				// can the next frame be compared with the one on display?
 	INT32				m_last_partial_scan;		// scanline of last partial update
 	bitmap_t *			m_screen_overlay_bitmap;	// screen overlay bitmap
 
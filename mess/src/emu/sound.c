@@ -643,12 +643,11 @@ stream_sample_t *sound_stream::generate_resampled_data(stream_input &input, UINT
 	// if we have equal sample rates, we just need to copy
 	if (step == FRAC_ONE)
 	{
-		while (numsamples--)
-		{
-			// compute the sample
-			stream_sample_t sample = *source++;
-			*dest++ = (sample * gain) >> 8;
-		}
+		if (gain == 0x100)
+			memcpy(dest, source, numsamples * sizeof(*dest));
+		else
+			for (UINT32 sampnum = 0; sampnum < numsamples; sampnum++)
+				dest[sampnum] = (source[sampnum] * gain) >> 8;
 	}
 
 	// input is undersampled: point sample except where our sample period covers a boundary
@@ -692,14 +691,20 @@ stream_sample_t *sound_stream::generate_resampled_data(stream_input &input, UINT
 			int remainder = smallstep;
 			int tpos = 0;
 
-			// compute the sample
+			// compute the sample: a partial first sample, a run of whole ones summed
+			// together before weighting, and a partial last one
 			int scale = (FRAC_ONE - basefrac) >> (FRAC_BITS - 8);
 			stream_sample_t sample = source[tpos++] * scale;
 			remainder -= scale;
-			while (remainder > 0x100)
+			if (remainder > 0x100)
 			{
-				sample += source[tpos++] * 0x100;
-				remainder -= 0x100;
+				int whole = (remainder - 1) >> 8;
+				stream_sample_t sum = 0;
+				for (int sampnum = 0; sampnum < whole; sampnum++)
+					sum += source[tpos + sampnum];
+				sample += sum * 0x100;
+				tpos += whole;
+				remainder -= whole * 0x100;
 			}
 			sample += source[tpos] * remainder;
 			sample /= smallstep;
@@ -1006,12 +1011,23 @@ void sound_manager::update()
 	for (speaker_device *speaker = downcast<speaker_device *>(machine().devicelist().first(SPEAKER)); speaker != NULL; speaker = speaker->next_speaker())
 		speaker->mix(m_leftmix, m_rightmix, samples_this_update, (m_muted & MUTE_REASON_SYSTEM));
 
-	// now downmix the final result
+	// now downmix the final result; at normal speed every sample is used, so
+	// clamp and interleave them in one straight pass
 	UINT32 finalmix_step = machine().video().speed_factor();
 	UINT32 finalmix_offset = 0;
 	INT16 *finalmix = m_finalmix;
-	int sample;
-	for (sample = m_finalmix_leftover; sample < samples_this_update * 100; sample += finalmix_step)
+	int sample = m_finalmix_leftover;
+	if (finalmix_step == 100 && sample == 0)
+	{
+		for (int sampindex = 0; sampindex < samples_this_update; sampindex++)
+		{
+			finalmix[2 * sampindex + 0] = MAX(-32768, MIN(32767, m_leftmix[sampindex]));
+			finalmix[2 * sampindex + 1] = MAX(-32768, MIN(32767, m_rightmix[sampindex]));
+		}
+		finalmix_offset = 2 * samples_this_update;
+		sample = samples_this_update * 100;
+	}
+	for ( ; sample < samples_this_update * 100; sample += finalmix_step)
 	{
 		int sampindex = sample / 100;
 
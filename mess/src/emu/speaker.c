@@ -151,14 +151,15 @@ void speaker_device::sound_stream_update(sound_stream &stream, stream_sample_t *
 {
 	VPRINTF(("Mixer_update(%d)\n", samples));
 
-	// loop over samples
-	for (int pos = 0; pos < samples; pos++)
+	// add up all the inputs a whole input at a time, so each pass is one
+	// straight run through memory
+	stream_sample_t *output = outputs[0];
+	memcpy(output, inputs[0], samples * sizeof(*output));
+	for (int inp = 1; inp < m_auto_allocated_inputs; inp++)
 	{
-		// add up all the inputs
-		INT32 sample = inputs[0][pos];
-		for (int inp = 1; inp < m_auto_allocated_inputs; inp++)
-			sample += inputs[inp][pos];
-		outputs[0][pos] = sample;
+		const stream_sample_t *input = inputs[inp];
+		for (int pos = 0; pos < samples; pos++)
+			output[pos] += input[pos];
 	}
 }
 
@@ -86,7 +86,7 @@ const UINT8 video_manager::s_skiptable[FRAMESKIP_LEVELS][FRAMESKIP_LEVELS] =
 //**************************************************************************
 
 // software rendering
-static void rgb888_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch);
+static void rgb888_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, const rectangle *clip);
 
 
 
@@ -112,8 +112,14 @@ video_manager::video_manager(running_machine &machine)
 	  m_overall_real_ticks(0),
 	  m_overall_emutime(attotime::zero),
 	  m_overall_valid_counter(0),
+	  m_benchmark(false),
+	  m_bench_start_ticks(0),
+	  m_bench_start_emutime(attotime::zero),
+	  m_bench_frames(0),
 	  m_throttle(machine.options().throttle()),
 	  m_fastforward(false),
+	  m_host_paced(false),
+	  m_skip_until(attotime::zero),
 	  m_seconds_to_run(machine.options().seconds_to_run()),
 	  m_auto_frameskip(machine.options().auto_frameskip()),
 	  m_speed(original_speed_setting()),
@@ -140,6 +146,8 @@ video_manager::video_manager(running_machine &machine)
 
 	// extract initial execution state from global configuration settings
 	update_refresh_speed();
+	if (machine.options().bench() > 0)
+		begin_benchmark();
 
 	// create a render target for snapshots
 	const char *viewname = machine.options().snap_view();
@@ -243,6 +251,13 @@ void video_manager::frame_update(bool debug)
 
 	// if we're throttling, synchronize before rendering
 	attotime current_time = machine().time();
+
+	// latch the benchmark starting point on the first frame
+	if (m_benchmark && !debug && m_bench_frames++ == 0)
+	{
+		m_bench_start_ticks = osd_ticks();
+		m_bench_start_emutime = current_time;
+	}
 	if (!debug && !skipped_it && effective_throttle())
 		update_throttle(current_time);
 
@@ -282,6 +297,34 @@ void video_manager::frame_update(bool debug)
 }
 
 
+//-------------------------------------------------
+//  skip_drawing - return true if nothing drawn
+//  during the current frame will be shown, so
+//  drivers that render as the beam goes can leave
+//  their bitmaps alone and only do the work that
+//  has side effects, like collision flags
+//-------------------------------------------------
+
+bool video_manager::skip_drawing() const
+{
+	// drivers that must always be updated still see every frame
+	if (machine().config().m_video_attributes & VIDEO_ALWAYS_UPDATE)
+		return false;
+	if (!m_skipping_this_frame)
+		return false;
+
+	// a driver that races the beam on its own timer (the Game Boy LCD) can
+	// run frames a few cycles longer than the screen's, and then a line it
+	// draws just before the update isn't drawn again in time for the next
+	// frame that is shown; so the last scanline of a skipped frame is drawn
+	screen_device *screen = machine().primary_screen;
+	if (screen != NULL && screen->time_until_update() < screen->scan_period())
+		return false;
+
+	return true;
+}
+
+
 //-------------------------------------------------
 //  speed_text - print the text to be displayed
 //  into a string buffer
@@ -323,6 +366,96 @@ astring &video_manager::speed_text(astring &string)
 }
 
 
+//-------------------------------------------------
+//  begin_benchmark - start collecting timing
+//  data for a report printed on exit
+//-------------------------------------------------
+
+void video_manager::begin_benchmark()
+{
+	m_benchmark = true;
+	m_bench_frames = 0;
+	g_profiler.enable(true);
+}
+
+
+//-------------------------------------------------
+//  benchmark_text - print the overall speed and
+//  per-subsystem breakdown since the benchmark
+//  began into a string buffer
+//-------------------------------------------------
+
+astring &video_manager::benchmark_text(astring &string)
+{
+	static const struct
+	{
+		profile_type	type;
+		const char *	name;
+	} categories[] =
+	{
+		{ PROFILER_SOUND,           "Sound update" },
+		{ PROFILER_VIDEO,           "Screen update" },
+		{ PROFILER_BLIT,            "Render/OSD" },
+		{ PROFILER_TIMER_CALLBACK,  "Timer callbacks" }
+	};
+
+	string.reset();
+	if (m_bench_frames < 2)
+		return string.cpy("Benchmark: not enough frames to report\n");
+
+	// compute the overall numbers
+	osd_ticks_t tps = osd_ticks_per_second();
+	double real_time = (double)(osd_ticks() - m_bench_start_ticks) / (double)tps;
+	double emu_time = (machine().time() - m_bench_start_emutime).as_double();
+	UINT32 frames = m_bench_frames - 1;
+	double ns_per_frame = real_time * 1e9 / (double)frames;
+	string.printf("Benchmark: %s, %.2f emulated seconds (%d frames) in %.3f real seconds\n", machine().system().name, emu_time, frames, real_time);
+	string.catprintf("Emulated speed: %.2f%%\n", (real_time > 0) ? 100.0 * emu_time / real_time : 0.0);
+	string.catprintf("Host time per frame: %.0f ns\n", ns_per_frame);
+
+	// how much of each CPU's time went by in skipped idle loops
+	device_execute_interface *exec;
+	for (bool gotone = machine().devicelist().first(exec); gotone; gotone = exec->next(exec))
+		if (exec->idle_loops_skipped() != 0 && exec->total_cycles() != 0)
+			string.catprintf("Idle loops skipped: '%s' %.1f%% of its cycles, %d times\n", exec->device().tag(), 100.0 * (double)exec->idle_cycles_skipped() / (double)exec->total_cycles(), exec->idle_loops_skipped());
+
+	// everything below comes from the profiler
+	if (!g_profiler.enabled())
+		return string.cat("Per-subsystem breakdown requires a profiler build (PROFILER=1)\n");
+
+	UINT64 total = 0;
+	for (profile_type curtype = PROFILER_DEVICE_FIRST; curtype < PROFILER_PROFILER; curtype++)
+		total += g_profiler.total(curtype);
+	if (total == 0)
+		return string;
+
+	// CPU execution is the sum of all the per-device buckets
+	UINT64 cpu_total = 0;
+	for (profile_type curtype = PROFILER_DEVICE_FIRST; curtype <= PROFILER_DEVICE_MAX; curtype++)
+		cpu_total += g_profiler.total(curtype);
+
+	string.cat("Breakdown (share of profiled time, ns per frame):\n");
+	string.catprintf("  %5.1f%% %10.0f  CPU execute (%d switches/frame)\n", 100.0 * cpu_total / total, ns_per_frame * cpu_total / total, (int)(g_profiler.total_context_switches() / frames));
+	for (profile_type curtype = PROFILER_DEVICE_FIRST; curtype <= PROFILER_DEVICE_MAX; curtype++)
+	{
+		UINT64 ticks = g_profiler.total(curtype);
+		device_t *device = machine().devicelist().find(curtype - PROFILER_DEVICE_FIRST);
+		if (ticks != 0 && device != NULL)
+			string.catprintf("  %5.1f%% %10.0f    '%s'\n", 100.0 * ticks / total, ns_per_frame * ticks / total, device->tag());
+	}
+
+	UINT64 accounted = cpu_total;
+	for (int catnum = 0; catnum < ARRAY_LENGTH(categories); catnum++)
+	{
+		UINT64 ticks = g_profiler.total(categories[catnum].type);
+		string.catprintf("  %5.1f%% %10.0f  %s\n", 100.0 * ticks / total, ns_per_frame * ticks / total, categories[catnum].name);
+		accounted += ticks;
+	}
+	string.catprintf("  %5.1f%% %10.0f  Other\n", 100.0 * (total - accounted) / total, ns_per_frame * (total - accounted) / total);
+	return string;
+}
+
+
 //-------------------------------------------------
 //  save_snapshot - save a snapshot to the given
 //  file handle
@@ -821,6 +954,11 @@ void video_manager::update_throttle(attotime emutime)
 		if (real_is_ahead_attoseconds < 0)
 			return;
 
+		// if the host paces us, it will call back once real time has caught up;
+		// never block it, just keep the accounting above up to date
+		if (m_host_paced)
+			return;
+
 		// compute the target real time, in ticks, where we want to be
 		osd_ticks_t target_ticks = m_throttle_last_ticks + real_is_ahead_attoseconds / attoseconds_per_tick;
 
@@ -942,6 +1080,14 @@ void video_manager::update_frameskip()
 	// increment the frameskip counter and determine if we will skip the next frame
 	m_frameskip_counter = (m_frameskip_counter + 1) % FRAMESKIP_LEVELS;
 	m_skipping_this_frame = s_skiptable[effective_frameskip()][m_frameskip_counter];
+
+	// if the host has asked for just the last frame of its slice, skip any before it
+	if (m_host_paced && machine().primary_screen != NULL)
+	{
+		attotime period = machine().primary_screen->frame_period();
+		if (machine().time() + period + period <= m_skip_until)
+			m_skipping_this_frame = true;
+	}
 }
 
 
@@ -1046,6 +1192,13 @@ void video_manager::recompute_speed(attotime emutime)
 				save_snapshot(machine().primary_screen, file);
 		}
 
+		// report the benchmark while the devices are still around to name
+		if (m_benchmark)
+		{
+			astring bench;
+			mame_printf_info("%s", benchmark_text(bench).cstr());
+		}
+
 		// schedule our demise
 		machine().schedule_exit();
 	}
@@ -1086,7 +1239,7 @@ void video_manager::create_snapshot_bitmap(device_t *screen)
 	// render the screen there
 	render_primitive_list &primlist = m_snap_target->get_primitives();
 	primlist.acquire_lock();
-	rgb888_draw_primitives(primlist, m_snap_bitmap->base, width, height, m_snap_bitmap->rowpixels);
+	rgb888_draw_primitives(primlist, m_snap_bitmap->base, width, height, m_snap_bitmap->rowpixels, NULL);
 	primlist.release_lock();
 }
 
@@ -88,10 +88,12 @@ public:
 	// getters
 	running_machine &machine() const { return m_machine; }
 	bool skip_this_frame() const { return m_skipping_this_frame; }
+	bool skip_drawing() const;
 	int speed_factor() const { return m_speed; }
 	int frameskip() const { return m_auto_frameskip ? -1 : m_frameskip_level; }
 	bool throttled() const { return m_throttle; }
 	bool fastforward() const { return m_fastforward; }
+	bool host_paced() const { return m_host_paced; }
 	bool is_recording() const { return (m_mngfile != NULL || m_avifile != NULL); }
 
 	// setters
@@ -99,6 +101,8 @@ public:
 	void set_frameskip(int frameskip);
 	void set_throttled(bool throttled = true) { m_throttle = throttled; }
 	void set_fastforward(bool ffwd = true) { m_fastforward = ffwd; }
+	void set_host_paced(bool paced = true) { m_host_paced = paced; }
+	void skip_frames_until(attotime time) { m_skip_until = time; }
 
 	// render a frame
 	void frame_update(bool debug = false);
@@ -107,6 +111,10 @@ public:
 	astring &speed_text(astring &string);
 	double speed_percent() const { return m_speed_percent; }
 
+	// benchmarking
+	void begin_benchmark();
+	astring &benchmark_text(astring &string);
+
 	// snapshots
 	void save_snapshot(screen_device *screen, emu_file &file);
 	void save_active_screen_snapshots();
@@ -164,9 +172,17 @@ private:
 	attotime			m_overall_emutime;			// accumulated emulated time at normal speed
 	UINT32				m_overall_valid_counter;	// number of consecutive valid time periods
 
+	// benchmarking
+	bool				m_benchmark;				// flag: TRUE if we report a benchmark on exit
+	osd_ticks_t			m_bench_start_ticks;		// real time at the first benchmarked frame
+	attotime			m_bench_start_emutime;		// emulated time at the first benchmarked frame
+	UINT32				m_bench_frames;				// number of frames since the first benchmarked frame
+
 	// configuration
 	bool				m_throttle;					// flag: TRUE if we're currently throttled
 	bool				m_fastforward;				// flag: TRUE if we're currently fast-forwarding
+	bool				m_host_paced;				// flag: TRUE if the host main loop paces us
+	attotime			m_skip_until;				// when host paced, skip frames that end before this
 	UINT32				m_seconds_to_run;			// number of seconds to run before quitting
 	bool				m_auto_frameskip;			// flag: TRUE if we're automatically frameskipping
 	UINT32				m_speed;					// overall speed (*100)
@@ -133,6 +133,10 @@ static void (*const ModeHandlers[])(device_t *screen, bitmap_t *bitmap, const re
 #define TMS_MODE ( (TMS_REVA ? (tms.Regs[0] & 2) : 0) | \
 	((tms.Regs[1] & 0x10)>>4) | ((tms.Regs[1] & 8)>>1))
 
+/* does the cell built from these name, pattern and colour addresses need drawing? */
+#define TMS_CELL_DIRTY(name,pattern,colour) (tms.RedrawAll || \
+	tms.DirtyBlock[(name)>>3] || tms.DirtyBlock[(pattern)>>3] || tms.DirtyBlock[(colour)>>3])
+
 typedef struct {
     /* TMS9928A internal settings */
     UINT8 ReadAhead,Regs[8],StatusReg,latch,INT;
@@ -143,6 +147,9 @@ typedef struct {
     /* memory */
     UINT8 *vMem, *dBackMem;
     bitmap_t *tmpbmp;
+    /* tmpbmp cache: one flag per 8 bytes of VRAM written since the last redraw */
+    UINT8 *DirtyBlock;
+    int anyDirty, RedrawAll;
     int vramsize, model;
     /* emulation settings */
     int LimitSprites; /* max 4 sprites on a row, like original TMS9918A */
@@ -174,6 +181,12 @@ void TMS9928A_reset () {
     tms.colourmask = tms.patternmask = 0;
     tms.Addr = tms.ReadAhead = tms.INT = 0;
 	tms.latch = 0;
+	tms.RedrawAll = 1;
+}
+
+static void TMS9928A_cache_post_load (running_machine &machine) {
+	/* VRAM was restored behind our back */
+	tms.RedrawAll = 1;
 }
 
 static void TMS9928A_start (running_machine &machine, const TMS9928a_interface *intf)
@@ -208,6 +221,10 @@ static void TMS9928A_start (running_machine &machine, const TMS9928a_interface *
     /* back bitmap */
     tms.tmpbmp = auto_bitmap_alloc (machine, 256, 192, machine.primary_screen->format());
 
+    /* dirty flags for the back bitmap */
+    tms.DirtyBlock = auto_alloc_array_clear(machine, UINT8, intf->vram / 8);
+    tms.anyDirty = 0;
+
     TMS9928A_reset ();
     tms.LimitSprites = 1;
 
@@ -225,6 +242,7 @@ static void TMS9928A_start (running_machine &machine, const TMS9928a_interface *
 	state_save_register_item(machine, "tms9928a", NULL, 0, tms.Addr);
 	state_save_register_item(machine, "tms9928a", NULL, 0, tms.INT);
 	state_save_register_item_pointer(machine, "tms9928a", NULL, 0, tms.vMem, intf->vram);
+	machine.save().register_postload(save_prepost_delegate(FUNC(TMS9928A_cache_post_load), &machine));
 }
 
 const rectangle *TMS9928A_get_visarea (void)
@@ -259,7 +277,11 @@ READ8_HANDLER (TMS9928A_vram_r) {
 
 WRITE8_HANDLER (TMS9928A_vram_w) {
 
-    tms.vMem[tms.Addr] = data;
+    if (tms.vMem[tms.Addr] != data) {
+        tms.vMem[tms.Addr] = data;
+        tms.DirtyBlock[tms.Addr >> 3] = 1;
+        tms.anyDirty = 1;
+    }
     tms.Addr = (tms.Addr + 1) & (tms.vramsize - 1);
     tms.ReadAhead = data;
     tms.latch = 0;
@@ -314,6 +336,8 @@ static void change_register (running_machine &machine, int reg, UINT8 val) {
     UINT8 b;
 
     val &= Mask[reg];
+    if (tms.Regs[reg] != val)
+        tms.RedrawAll = 1;
     tms.Regs[reg] = val;
 
     logerror("TMS9928A: Reg %d = %02xh\n", reg, (int)val);
@@ -404,7 +428,13 @@ SCREEN_UPDATE( tms9928a )
 		bitmap_fill(bitmap, cliprect, screen->machine().pens[BackColour]);
 	else
 	{
-		(*ModeHandlers[TMS_MODE])(screen, tms.tmpbmp, cliprect);
+		/* only cells touched since the last redraw are drawn again */
+		if (tms.RedrawAll || tms.anyDirty)
+		{
+			(*ModeHandlers[TMS_MODE])(screen, tms.tmpbmp, cliprect);
+			memset(tms.DirtyBlock, 0, tms.vramsize / 8);
+			tms.anyDirty = tms.RedrawAll = 0;
+		}
 
 		copybitmap(bitmap, tms.tmpbmp, 0, 0, LEFT_BORDER, TOP_BORDER, cliprect);
 		{
@@ -434,7 +464,7 @@ int TMS9928A_interrupt(running_machine &machine) {
     int b;
 
     /* when skipping frames, calculate sprite collision */
-    if (machine.video().skip_this_frame()) {
+    if (machine.video().skip_drawing()) {
 		if (TMS_SPRITES_ENABLED) {
 			draw_sprites (machine.primary_screen, NULL, NULL);
 		}
@@ -473,6 +503,8 @@ static void draw_mode1 (device_t *screen, bitmap_t *bitmap, const rectangle *cli
         for (x=0;x<40;x++) {
             charcode = tms.vMem[tms.nametbl+name];
             name++;
+            if (!TMS_CELL_DIRTY(tms.nametbl+name-1, tms.pattern+charcode*8, tms.pattern+charcode*8))
+                continue;
             patternptr = tms.vMem + tms.pattern + (charcode*8);
             for (yy=0;yy<8;yy++) {
                 pattern = *patternptr++;
@@ -508,6 +540,8 @@ static void draw_mode12 (device_t *screen, bitmap_t *bitmap, const rectangle *cl
         for (x=0;x<40;x++) {
             charcode = (tms.vMem[tms.nametbl+name]+(y/8)*256)&tms.patternmask;
             name++;
+            if (!TMS_CELL_DIRTY(tms.nametbl+name-1, tms.pattern+charcode*8, tms.pattern+charcode*8))
+                continue;
             patternptr = tms.vMem + tms.pattern + (charcode*8);
             for (yy=0;yy<8;yy++) {
                 pattern = *patternptr++;
@@ -531,6 +565,8 @@ static void draw_mode0 (device_t *screen, bitmap_t *bitmap, const rectangle *cli
         for (x=0;x<32;x++) {
             charcode = tms.vMem[tms.nametbl+name];
             name++;
+            if (!TMS_CELL_DIRTY(tms.nametbl+name-1, tms.pattern+charcode*8, tms.colour+charcode/8))
+                continue;
             patternptr = tms.vMem + tms.pattern + charcode*8;
             colour = tms.vMem[tms.colour+charcode/8];
             fg = pens[colour / 16];
@@ -560,6 +596,8 @@ static void draw_mode2 (device_t *screen, bitmap_t *bitmap, const rectangle *cli
             name++;
             colour = (charcode&tms.colourmask);
             pattern = (charcode&tms.patternmask);
+            if (!TMS_CELL_DIRTY(tms.nametbl+name-1, tms.pattern+colour*8, tms.colour+pattern*8))
+                continue;
             patternptr = tms.vMem+tms.pattern+colour*8;
             colourptr = tms.vMem+tms.colour+pattern*8;
             for (yy=0;yy<8;yy++) {
@@ -587,6 +625,8 @@ static void draw_mode3 (device_t *screen, bitmap_t *bitmap, const rectangle *cli
         for (x=0;x<32;x++) {
             charcode = tms.vMem[tms.nametbl+name];
             name++;
+            if (!TMS_CELL_DIRTY(tms.nametbl+name-1, tms.pattern+charcode*8, tms.pattern+charcode*8))
+                continue;
             patternptr = tms.vMem+tms.pattern+charcode*8+(y&3)*2;
             for (yy=0;yy<2;yy++) {
                 fg = pens[(*patternptr / 16)];
@@ -617,8 +657,10 @@ static void draw_mode23 (device_t *screen, bitmap_t *bitmap, const rectangle *cl
         for (x=0;x<32;x++) {
             charcode = tms.vMem[tms.nametbl+name];
             name++;
-            patternptr = tms.vMem + tms.pattern +
-                ((charcode+(y&3)*2+(y/8)*256)&tms.patternmask)*8;
+            charcode = (charcode+(y&3)*2+(y/8)*256)&tms.patternmask;
+            if (!TMS_CELL_DIRTY(tms.nametbl+name-1, tms.pattern+charcode*8, tms.pattern+charcode*8))
+                continue;
+            patternptr = tms.vMem + tms.pattern + charcode*8;
             for (yy=0;yy<2;yy++) {
                 fg = pens[(*patternptr / 16)];
                 bg = pens[((*patternptr++) & 15)];
@@ -646,6 +688,10 @@ static void draw_modebogus (device_t *screen, bitmap_t *bitmap, const rectangle
     fg = pens[tms.Regs[7] / 16];
     bg = pens[tms.Regs[7] & 15];
 
+    /* nothing here comes from VRAM */
+    if (!tms.RedrawAll)
+        return;
+
     for (y=0;y<192;y++) {
         xx=0;
         n=8; while (n--) *BITMAP_ADDR16(bitmap, y, xx++) = bg;
@@ -54,6 +54,7 @@
 ***************************************************************************/
 
 #define PRINTF_MAX_HUNK				(0)
+#define PRINTF_CACHE_STATS			(0)
 
 
 
@@ -66,6 +67,9 @@
 #define OLD_MAP_ENTRY_SIZE			8			/* V1-V2 */
 #define METADATA_HEADER_SIZE		16			/* metadata header size */
 #define CRCMAP_HASH_SIZE			4095		/* number of CRC hashtable entries */
+#define READ_CACHE_BYTES			(256 * 1024)	/* default size of the read cache */
+#define READ_CACHE_MIN_HUNKS		2			/* default minimum hunks in the read cache */
+#define READ_CACHE_MAX_HUNKS		64			/* default maximum hunks in the read cache */
 
 #define MAP_ENTRY_FLAG_TYPE_MASK	0x0f		/* what type of hunk */
 #define MAP_ENTRY_FLAG_NO_CRC		0x10		/* no CRC is present */
@@ -135,6 +139,16 @@ struct _crcmap_entry
 };
 
 
+/* an entry in the read cache */
+typedef struct _readcache_entry readcache_entry;
+struct _readcache_entry
+{
+	UINT32					hunknum;		/* index of the cached hunk, or ~0 if none */
+	UINT32					lastuse;		/* value of the cache clock at last use */
+	UINT8 *					data;			/* decompressed hunk data, allocated on first use */
+};
+
+
 /* a single metadata entry */
 typedef struct _metadata_entry metadata_entry;
 struct _metadata_entry
@@ -167,6 +181,12 @@ struct _chd_file
 	UINT8 *					compare;		/* hunk compare pointer */
 	UINT32					comparehunk;	/* index of current compare data */
 
+	readcache_entry *		readcache;		/* LRU cache of hunks read by chd_read() */
+	UINT32					readclock;		/* clock for LRU replacement in the read cache */
+	UINT32					lastread;		/* index of the last hunk read by chd_read() */
+	readcache_entry *		readahead;		/* read cache entry being filled asynchronously */
+	chd_cache_stats			cachestats;		/* read cache statistics */
+
 	UINT8 *					compressed;		/* pointer to buffer for compressed data */
 	const codec_interface *	codecintf;		/* interface to the codec */
 	void *					codecdata;		/* opaque pointer to codec data */
@@ -251,6 +271,15 @@ static chd_error hunk_read_into_cache(chd_file *chd, UINT32 hunknum);
 static chd_error hunk_read_into_memory(chd_file *chd, UINT32 hunknum, UINT8 *dest);
 static chd_error hunk_write_from_memory(chd_file *chd, UINT32 hunknum, const UINT8 *src);
 
+/* internal read cache operations */
+static chd_error readcache_alloc(chd_file *chd, UINT32 hunks);
+static void readcache_free(chd_file *chd);
+static readcache_entry *readcache_find(chd_file *chd, UINT32 hunknum);
+static readcache_entry *readcache_victim(chd_file *chd);
+static chd_error readcache_read(chd_file *chd, UINT32 hunknum, UINT8 *dest);
+static void readahead_start(chd_file *chd, UINT32 hunknum);
+static void readahead_complete(chd_file *chd);
+
 /* internal map access */
 static chd_error map_write_initial(core_file *file, chd_file *parent, const chd_header *header);
 static chd_error map_read(chd_file *chd);
@@ -514,6 +543,10 @@ INLINE void wait_for_pending_async(chd_file *chd)
 		int wait_successful = osd_work_item_wait(chd->workitem, 10 * osd_ticks_per_second());
 		if (!wait_successful)
 			osd_break_into_debugger("Pending async operation never completed!");
+
+		/* nobody calls chd_async_complete() for a read-ahead, so finish it here */
+		if (chd->readahead != NULL)
+			readahead_complete(chd);
 	}
 }
 
@@ -695,6 +728,11 @@ chd_error chd_open_file(core_file *file, int mode, chd_file *parent, chd_file **
 	newchd->cachehunk = ~0;
 	newchd->comparehunk = ~0;
 
+	/* allocate the read cache; hunk data is allocated as it gets used */
+	err = readcache_alloc(newchd, MAX(READ_CACHE_MIN_HUNKS, MIN(READ_CACHE_MAX_HUNKS, READ_CACHE_BYTES / newchd->header.hunkbytes)));
+	if (err != CHDERR_NONE)
+		EARLY_EXIT(err);
+
 	/* allocate the temporary compressed buffer */
 	newchd->compressed = (UINT8 *)malloc(newchd->header.hunkbytes);
 	if (newchd->compressed == NULL)
@@ -840,6 +878,10 @@ void chd_close(chd_file *chd)
 	if (chd->cache != NULL)
 		free(chd->cache);
 
+	/* free the read cache */
+	if (PRINTF_CACHE_STATS) printf("Read cache: %d hunks, %d hits, %d misses, %d read ahead\n", chd->cachestats.hunks, (int)chd->cachestats.hits, (int)chd->cachestats.misses, (int)chd->cachestats.readaheads);
+	readcache_free(chd);
+
 	/* free the hunk map */
 	if (chd->map != NULL)
 		free(chd->map);
@@ -1036,8 +1078,8 @@ chd_error chd_read(chd_file *chd, UINT32 hunknum, void *buffer)
 	/* wait for any pending async operations */
 	wait_for_pending_async(chd);
 
-	/* perform the read */
-	return hunk_read_into_memory(chd, hunknum, (UINT8 *)buffer);
+	/* perform the read through the cache */
+	return readcache_read(chd, hunknum, (UINT8 *)buffer);
 }
 
 
@@ -1136,6 +1178,10 @@ chd_error chd_async_complete(chd_file *chd)
 {
 	void *result;
 
+	/* a pending read-ahead is not the caller's operation; just let it finish */
+	if (chd->readahead != NULL)
+		wait_for_pending_async(chd);
+
 	/* if nothing present, return an error */
 	if (chd->workitem == NULL)
 		return CHDERR_NO_ASYNC_OPERATION;
@@ -1153,6 +1199,47 @@ chd_error chd_async_complete(chd_file *chd)
 
 
 
+/***************************************************************************
+    READ CACHE MANAGEMENT
+***************************************************************************/
+
+/*-------------------------------------------------
+    chd_set_cache_hunks - resize the cache of
+    recently read hunks; 0 disables caching and
+    read-ahead
+-------------------------------------------------*/
+
+chd_error chd_set_cache_hunks(chd_file *chd, UINT32 hunks)
+{
+	/* punt if NULL or invalid */
+	if (chd == NULL || chd->cookie != COOKIE_VALUE)
+		return CHDERR_INVALID_PARAMETER;
+
+	/* wait for any pending async operations */
+	wait_for_pending_async(chd);
+
+	/* throw away the old cache and make a new one */
+	readcache_free(chd);
+	return readcache_alloc(chd, hunks);
+}
+
+
+/*-------------------------------------------------
+    chd_get_cache_stats - return a pointer to the
+    read cache statistics
+-------------------------------------------------*/
+
+const chd_cache_stats *chd_get_cache_stats(chd_file *chd)
+{
+	/* punt if NULL or invalid */
+	if (chd == NULL || chd->cookie != COOKIE_VALUE)
+		return NULL;
+
+	return &chd->cachestats;
+}
+
+
+
 /***************************************************************************
     METADATA MANAGEMENT
 ***************************************************************************/
@@ -1999,6 +2086,7 @@ static chd_error hunk_write_from_memory(chd_file *chd, UINT32 hunknum, const UIN
 	map_entry newentry;
 	UINT8 fileentry[MAP_ENTRY_SIZE];
 	const void *data = src;
+	readcache_entry *cached;
 	UINT32 bytes = 0, match;
 	chd_error err;
 
@@ -2006,6 +2094,11 @@ static chd_error hunk_write_from_memory(chd_file *chd, UINT32 hunknum, const UIN
 	if (hunknum > chd->maxhunk)
 		chd->maxhunk = hunknum;
 
+	/* drop any stale copy from the read cache */
+	cached = readcache_find(chd, hunknum);
+	if (cached != NULL)
+		cached->hunknum = ~0;
+
 	/* first compute the CRC of the original data */
 	newentry.crc = 0;
 	if (src != NULL)
@@ -2111,6 +2204,206 @@ write_entry:
 
 
 
+/***************************************************************************
+    INTERNAL READ CACHE ACCESS
+***************************************************************************/
+
+/*-------------------------------------------------
+    readcache_alloc - allocate an empty read
+    cache of the given number of hunks
+-------------------------------------------------*/
+
+static chd_error readcache_alloc(chd_file *chd, UINT32 hunks)
+{
+	UINT32 entrynum;
+
+	chd->cachestats.hunks = 0;
+	chd->readcache = NULL;
+	chd->lastread = ~0;
+	if (hunks == 0)
+		return CHDERR_NONE;
+
+	/* the entries start out empty, with no data */
+	chd->readcache = (readcache_entry *)malloc(hunks * sizeof(chd->readcache[0]));
+	if (chd->readcache == NULL)
+		return CHDERR_OUT_OF_MEMORY;
+	for (entrynum = 0; entrynum < hunks; entrynum++)
+	{
+		chd->readcache[entrynum].hunknum = ~0;
+		chd->readcache[entrynum].lastuse = 0;
+		chd->readcache[entrynum].data = NULL;
+	}
+	chd->cachestats.hunks = hunks;
+	return CHDERR_NONE;
+}
+
+
+/*-------------------------------------------------
+    readcache_free - free the read cache and all
+    of its hunk data
+-------------------------------------------------*/
+
+static void readcache_free(chd_file *chd)
+{
+	UINT32 entrynum;
+
+	if (chd->readcache == NULL)
+		return;
+
+	for (entrynum = 0; entrynum < chd->cachestats.hunks; entrynum++)
+		if (chd->readcache[entrynum].data != NULL)
+			free(chd->readcache[entrynum].data);
+	free(chd->readcache);
+	chd->readcache = NULL;
+	chd->cachestats.hunks = 0;
+}
+
+
+/*-------------------------------------------------
+    readcache_find - find a hunk in the read
+    cache, or return NULL
+-------------------------------------------------*/
+
+static readcache_entry *readcache_find(chd_file *chd, UINT32 hunknum)
+{
+	UINT32 entrynum;
+
+	for (entrynum = 0; entrynum < chd->cachestats.hunks; entrynum++)
+		if (chd->readcache[entrynum].hunknum == hunknum)
+			return &chd->readcache[entrynum];
+	return NULL;
+}
+
+
+/*-------------------------------------------------
+    readcache_victim - pick the least recently
+    used read cache entry and make sure it has
+    data allocated; returns NULL if it cannot
+-------------------------------------------------*/
+
+static readcache_entry *readcache_victim(chd_file *chd)
+{
+	readcache_entry *victim = NULL;
+	UINT32 entrynum;
+
+	if (chd->readcache == NULL)
+		return NULL;
+
+	/* empty entries go first, then the oldest */
+	for (entrynum = 0; entrynum < chd->cachestats.hunks; entrynum++)
+	{
+		readcache_entry *entry = &chd->readcache[entrynum];
+		if (entry->hunknum == ~0)
+		{
+			victim = entry;
+			break;
+		}
+		if (victim == NULL || (INT32)(entry->lastuse - victim->lastuse) < 0)
+			victim = entry;
+	}
+
+	/* allocate the hunk data the first time the entry is used */
+	if (victim->data == NULL)
+	{
+		victim->data = (UINT8 *)malloc(chd->header.hunkbytes);
+		if (victim->data == NULL)
+			return NULL;
+	}
+	victim->hunknum = ~0;
+	return victim;
+}
+
+
+/*-------------------------------------------------
+    readcache_read - read a hunk through the read
+    cache, reading the next one ahead when the
+    access pattern is sequential
+-------------------------------------------------*/
+
+static chd_error readcache_read(chd_file *chd, UINT32 hunknum, UINT8 *dest)
+{
+	int sequential = (hunknum == chd->lastread + 1);
+	readcache_entry *entry;
+	chd_error err;
+
+	chd->lastread = hunknum;
+
+	/* if we have it, just copy it out */
+	entry = readcache_find(chd, hunknum);
+	if (entry != NULL)
+		chd->cachestats.hits++;
+
+	/* otherwise, decompress into the least recently used entry */
+	else
+	{
+		chd->cachestats.misses++;
+		entry = readcache_victim(chd);
+		if (entry == NULL)
+			return hunk_read_into_memory(chd, hunknum, dest);
+
+		err = hunk_read_into_memory(chd, hunknum, entry->data);
+		if (err != CHDERR_NONE)
+			return err;
+		entry->hunknum = hunknum;
+	}
+	entry->lastuse = ++chd->readclock;
+	memcpy(dest, entry->data, chd->header.hunkbytes);
+
+	/* when reading sequentially, start on the next hunk in the background */
+	if (sequential && chd->cachestats.hunks > 1 && hunknum + 1 < chd->header.totalhunks && readcache_find(chd, hunknum + 1) == NULL)
+		readahead_start(chd, hunknum + 1);
+	return CHDERR_NONE;
+}
+
+
+/*-------------------------------------------------
+    readahead_start - queue an asynchronous read
+    of a hunk into the read cache
+-------------------------------------------------*/
+
+static void readahead_start(chd_file *chd, UINT32 hunknum)
+{
+	readcache_entry *entry = readcache_victim(chd);
+
+	/* the entry stays empty until the read completes */
+	if (entry == NULL)
+		return;
+	entry->lastuse = ++chd->readclock;
+
+	/* use the same machinery as chd_read_async() */
+	chd->async_hunknum = hunknum;
+	chd->async_buffer = entry->data;
+	if (queue_async_operation(chd, async_read_callback))
+	{
+		chd->readahead = entry;
+		chd->cachestats.readaheads++;
+	}
+}
+
+
+/*-------------------------------------------------
+    readahead_complete - collect the result of a
+    finished read-ahead
+-------------------------------------------------*/
+
+static void readahead_complete(chd_file *chd)
+{
+	readcache_entry *entry = chd->readahead;
+	chd_error err;
+
+	/* get the result and free the work item */
+	err = (chd_error)(ptrdiff_t)osd_work_item_result(chd->workitem);
+	osd_work_item_release(chd->workitem);
+	chd->workitem = NULL;
+	chd->readahead = NULL;
+
+	/* only a successful read makes it into the cache */
+	if (err == CHDERR_NONE)
+		entry->hunknum = chd->async_hunknum;
+}
+
+
+
 /***************************************************************************
     INTERNAL MAP ACCESS
 ***************************************************************************/
@@ -265,6 +265,17 @@ struct _chd_header
 };
 
 
+/* statistics about the cache of recently read hunks */
+typedef struct _chd_cache_stats chd_cache_stats;
+struct _chd_cache_stats
+{
+	UINT32		hunks;						/* number of hunks the cache holds */
+	UINT64		hits;						/* reads satisfied from the cache */
+	UINT64		misses;						/* reads that had to go to the file */
+	UINT64		readaheads;					/* hunks read ahead asynchronously */
+};
+
+
 /* structure for returning information about a verification pass */
 typedef struct _chd_verify_result chd_verify_result;
 struct _chd_verify_result
@@ -339,6 +350,16 @@ chd_error chd_async_complete(chd_file *chd);
 
 
 
+/* ----- read cache management ----- */
+
+/* set the number of recently read hunks to keep (0 disables caching and read-ahead) */
+chd_error chd_set_cache_hunks(chd_file *chd, UINT32 hunks);
+
+/* return a pointer to the read cache statistics */
+const chd_cache_stats *chd_get_cache_stats(chd_file *chd);
+
+
+
 /* ----- metadata management ----- */
 
 /* get indexed metadata of a particular sort */
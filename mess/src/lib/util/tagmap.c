@@ -47,6 +47,22 @@
 ***************************************************************************/
 
 static tagmap_error tagmap_add_common(tagmap *map, const char *tag, void *object, UINT8 replace_if_duplicate, UINT8 unique_hash);
+static void tagmap_grow(tagmap *map);
+
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* bucket counts to grow through, each about four times the last */
+static const UINT32 tagmap_sizes[] =
+{
+	TAGMAP_HASH_SIZE, 389, 1543, 6151, 24593, 98317, 393241, 1572869
+};
+
+/* average entries per bucket before the map grows */
+#define TAGMAP_MAX_LOAD		2
 
 
 
@@ -62,11 +78,24 @@ tagmap *tagmap_alloc(void)
 {
 	tagmap *map = (tagmap *)malloc(sizeof(*map));
 	if (map != NULL)
-		memset(map, 0, sizeof(*map));
+		tagmap_init(map);
 	return map;
 }
 
 
+/*-------------------------------------------------
+    tagmap_init - initialize a tagmap in place
+-------------------------------------------------*/
+
+void tagmap_init(tagmap *map)
+{
+	memset(map->initial, 0, sizeof(map->initial));
+	map->table = map->initial;
+	map->size = ARRAY_LENGTH(map->initial);
+	map->count = 0;
+}
+
+
 /*-------------------------------------------------
     tagmap_free - free a tagmap, and all
     entries within it
@@ -88,7 +117,7 @@ void tagmap_reset(tagmap *map)
 {
 	UINT32 hashindex;
 
-	for (hashindex = 0; hashindex < ARRAY_LENGTH(map->table); hashindex++)
+	for (hashindex = 0; hashindex < map->size; hashindex++)
 	{
 		tagmap_entry *entry, *next;
 
@@ -97,8 +126,12 @@ void tagmap_reset(tagmap *map)
 			next = entry->next;
 			free(entry);
 		}
-		map->table[hashindex] = NULL;
 	}
+
+	/* go back to the initial buckets */
+	if (map->table != map->initial)
+		free(map->table);
+	tagmap_init(map);
 }
 
 
@@ -139,12 +172,13 @@ void tagmap_remove(tagmap *map, const char *tag)
 	UINT32 fullhash = tagmap_hash(tag);
 	tagmap_entry **entryptr;
 
-	for (entryptr = &map->table[fullhash % ARRAY_LENGTH(map->table)]; *entryptr != NULL; entryptr = &(*entryptr)->next)
+	for (entryptr = &map->table[fullhash % map->size]; *entryptr != NULL; entryptr = &(*entryptr)->next)
 		if ((*entryptr)->fullhash == fullhash && strcmp((*entryptr)->tag, tag) == 0)
 		{
 			tagmap_entry *entry = *entryptr;
 			*entryptr = entry->next;
 			free(entry);
+			map->count--;
 			break;
 		}
 }
@@ -159,7 +193,7 @@ void tagmap_remove_object(tagmap *map, void *object)
 {
 	UINT32 hashindex;
 
-	for (hashindex = 0; hashindex < ARRAY_LENGTH(map->table); hashindex++)
+	for (hashindex = 0; hashindex < map->size; hashindex++)
 	{
 		tagmap_entry **entryptr;
 
@@ -169,6 +203,7 @@ void tagmap_remove_object(tagmap *map, void *object)
 				tagmap_entry *entry = *entryptr;
 				*entryptr = entry->next;
 				free(entry);
+				map->count--;
 				return;
 			}
 	}
@@ -188,7 +223,7 @@ void tagmap_remove_object(tagmap *map, void *object)
 static tagmap_error tagmap_add_common(tagmap *map, const char *tag, void *object, UINT8 replace_if_duplicate, UINT8 unique_hash)
 {
 	UINT32 fullhash = tagmap_hash(tag);
-	UINT32 hashindex = fullhash % ARRAY_LENGTH(map->table);
+	UINT32 hashindex = fullhash % map->size;
 	tagmap_entry *entry;
 
 	/* first make sure we don't have a duplicate */
@@ -214,5 +249,58 @@ static tagmap_error tagmap_add_common(tagmap *map, const char *tag, void *object
 	/* add it to the head of the list */
 	entry->next = map->table[hashindex];
 	map->table[hashindex] = entry;
+
+	/* keep the chains short as the map fills up */
+	if (++map->count > map->size * TAGMAP_MAX_LOAD)
+		tagmap_grow(map);
 	return TMERR_NONE;
 }
+
+
+/*-------------------------------------------------
+    tagmap_grow - move the entries to the next
+    larger set of buckets
+-------------------------------------------------*/
+
+static void tagmap_grow(tagmap *map)
+{
+	UINT32 newsize = 0;
+	tagmap_entry **newtable;
+	UINT32 hashindex;
+	UINT32 sizeindex;
+
+	/* find the next size up; stay put once we run out */
+	for (sizeindex = 0; sizeindex < ARRAY_LENGTH(tagmap_sizes); sizeindex++)
+		if (tagmap_sizes[sizeindex] > map->size)
+		{
+			newsize = tagmap_sizes[sizeindex];
+			break;
+		}
+	if (newsize == 0)
+		return;
+
+	/* if we can't get the memory, the old buckets still work */
+	newtable = (tagmap_entry **)malloc(newsize * sizeof(*newtable));
+	if (newtable == NULL)
+		return;
+	memset(newtable, 0, newsize * sizeof(*newtable));
+
+	/* rehash from the stored full hashes */
+	for (hashindex = 0; hashindex < map->size; hashindex++)
+	{
+		tagmap_entry *entry, *next;
+
+		for (entry = map->table[hashindex]; entry != NULL; entry = next)
+		{
+			UINT32 newindex = entry->fullhash % newsize;
+			next = entry->next;
+			entry->next = newtable[newindex];
+			newtable[newindex] = entry;
+		}
+	}
+
+	if (map->table != map->initial)
+		free(map->table);
+	map->table = newtable;
+	map->size = newsize;
+}
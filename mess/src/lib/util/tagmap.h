@@ -50,6 +50,7 @@
     CONSTANTS
 ***************************************************************************/
 
+/* buckets a map starts with; it grows past this as entries are added */
 #define TAGMAP_HASH_SIZE	97
 
 
@@ -82,7 +83,10 @@ struct _tagmap_entry
 typedef struct _tagmap tagmap;
 struct _tagmap
 {
-	tagmap_entry *		table[TAGMAP_HASH_SIZE];
+	tagmap_entry **		table;					/* current hash buckets */
+	UINT32				size;					/* number of buckets */
+	UINT32				count;					/* number of entries */
+	tagmap_entry *		initial[TAGMAP_HASH_SIZE];	/* buckets used until the map outgrows them */
 };
 
 
@@ -97,10 +101,13 @@ struct _tagmap
 /* allocate a new tagmap */
 tagmap *tagmap_alloc(void);
 
+/* initialize a tagmap in place */
+void tagmap_init(tagmap *map);
+
 /* free a tagmap, and all entries within it */
 void tagmap_free(tagmap *map);
 
-/* reset a tagmap by freeing all entries */
+/* reset a tagmap by freeing all entries and any grown buckets */
 void tagmap_reset(tagmap *map);
 
 
@@ -135,7 +142,7 @@ private:
 	tagmap_t &operator=(const tagmap &);
 
 public:
-	tagmap_t() { memset(table, 0, sizeof(table)); }
+	tagmap_t() { tagmap_init(this); }
 	~tagmap_t() { reset(); }
 
 	void reset() { tagmap_reset(this); }
@@ -184,7 +191,7 @@ INLINE void *tagmap_find_prehashed(const tagmap *map, const char *tag, UINT32 fu
 {
 	tagmap_entry *entry;
 
-	for (entry = map->table[fullhash % ARRAY_LENGTH(map->table)]; entry != NULL; entry = entry->next)
+	for (entry = map->table[fullhash % map->size]; entry != NULL; entry = entry->next)
 		if (entry->fullhash == fullhash && strcmp(entry->tag, tag) == 0)
 			return entry->object;
 	return NULL;
@@ -214,7 +221,7 @@ INLINE void *tagmap_find_hash_only(const tagmap *map, const char *tag)
 	UINT32 fullhash = tagmap_hash(tag);
 	tagmap_entry *entry;
 
-	for (entry = map->table[fullhash % ARRAY_LENGTH(map->table)]; entry != NULL; entry = entry->next)
+	for (entry = map->table[fullhash % map->size]; entry != NULL; entry = entry->next)
 		if (entry->fullhash == fullhash)
 			return entry->object;
 	return NULL;
@@ -471,6 +471,13 @@ static UINT16* megadrive_vdp_vsram;
 /* The VDP keeps a 0x400 byte on-chip cache of the Sprite Attribute Table
    to speed up processing */
 static UINT16* megadrive_vdp_internal_sprite_attribute_table;
+/* Decoded copies of the 0x4000 tile rows in VRAM, one byte per pixel, with
+   the x-flipped row stored after the normal one.  A row is only decoded when
+   the renderer needs it after its VRAM has been written to */
+static UINT8* megadrive_vdp_tile_cache;
+static UINT8* megadrive_vdp_tile_dirty;
+
+#define MEGADRIV_VDP_VRAM_CHANGED(address) megadrive_vdp_tile_dirty[((address)&0x7fff)>>1] = 1
 
 /*
 
@@ -604,6 +611,7 @@ static void vdp_vram_write(UINT16 data)
 	}
 
 	MEGADRIV_VDP_VRAM(megadrive_vdp_address>>1) = data;
+	MEGADRIV_VDP_VRAM_CHANGED(megadrive_vdp_address>>1);
 
 	/* The VDP stores an Internal copy of any data written to the Sprite Attribute Table.
        This data is _NOT_ invalidated when the Sprite Base Address changes, thus allowing
@@ -689,6 +697,7 @@ static void megadriv_vdp_data_port_w(running_machine &machine, int data)
 		{
 			MEGADRIV_VDP_VRAM((megadrive_vdp_address>>1))   = (MEGADRIV_VDP_VRAM((megadrive_vdp_address>>1))&0x00ff) | ((data&0x00ff)<<8);
 		}
+		MEGADRIV_VDP_VRAM_CHANGED(megadrive_vdp_address>>1);
 
 
 		for (count=0;count<=megadrive_vram_fill_length;count++) // <= for james pond 3
@@ -701,6 +710,7 @@ static void megadriv_vdp_data_port_w(running_machine &machine, int data)
 			{
 				MEGADRIV_VDP_VRAM((megadrive_vdp_address>>1))   = (MEGADRIV_VDP_VRAM((megadrive_vdp_address>>1))&0xff00) | ((data&0xff00)>>8);
 			}
+			MEGADRIV_VDP_VRAM_CHANGED(megadrive_vdp_address>>1);
 
 			megadrive_vdp_address+=MEGADRIVE_REG0F_AUTO_INC;
 			megadrive_vdp_address&=0xffff;
@@ -901,6 +911,7 @@ static void megadrive_do_insta_vram_copy(UINT32 source, UINT16 length)
 		{
 			MEGADRIV_VDP_VRAM((megadrive_vdp_address&0xffff)>>1) = (MEGADRIV_VDP_VRAM((megadrive_vdp_address&0xffff)>>1)&0x00ff) | (source_byte<<8);
 		}
+		MEGADRIV_VDP_VRAM_CHANGED((megadrive_vdp_address&0xffff)>>1);
 
 		source++;
 		megadrive_vdp_address+=MEGADRIVE_REG0F_AUTO_INC;
@@ -7242,6 +7253,10 @@ VIDEO_START(megadriv)
 	memset(megadrive_vdp_vsram, 0x00, 0x80);
 	memset(megadrive_vdp_internal_sprite_attribute_table, 0x00, 0x400);
 
+	megadrive_vdp_tile_cache = auto_alloc_array(machine, UINT8, 0x4000*16);
+	megadrive_vdp_tile_dirty = auto_alloc_array(machine, UINT8, 0x4000);
+	memset(megadrive_vdp_tile_dirty, 1, 0x4000);
+
 	megadrive_max_hposition = 480;
 
 	sprite_renderline = auto_alloc_array(machine, UINT8, 1024);
@@ -7333,14 +7348,18 @@ static TIMER_DEVICE_CALLBACK( frame_timer_callback )
 
 */
 
-static void genesis_render_spriteline_to_spritebuffer(int scanline)
+/* With collision_only set (the frame is being skipped) the line is only
+   walked for the collision flag, which is all a skipped frame can show;
+   overflow isn't emulated, so once the flag is up there is nothing left */
+static void genesis_render_spriteline_to_spritebuffer(int scanline, int collision_only)
 {
 	int screenwidth;
 	int maxsprites=0;
 	int maxpixels=0;
 	UINT16 base_address=0;
 
-
+	if (collision_only && megadrive_sprite_collision)
+		return;
 
 	screenwidth = MEGADRIVE_REG0C_RS0 | (MEGADRIVE_REG0C_RS1 << 1);
 
@@ -7471,7 +7490,7 @@ static void genesis_render_spriteline_to_spritebuffer(int scanline)
 							for(loopcount=0;loopcount<8;loopcount++)
 							{
 								dat = (gfxdata & 0xf0000000)>>28; gfxdata <<=4;
-								if (dat) { if (!sprite_renderline[xxx]) { sprite_renderline[xxx] = dat | (colour<<4)| pri; } else { megadrive_sprite_collision = 1; } }
+								if (dat) { if (!sprite_renderline[xxx]) { sprite_renderline[xxx] = dat | (colour<<4)| pri; } else { megadrive_sprite_collision = 1; if (collision_only) return; } }
 								xxx++;xxx&=0x1ff;
 								if (--maxpixels == 0x00) return;
 							}
@@ -7504,7 +7523,7 @@ static void genesis_render_spriteline_to_spritebuffer(int scanline)
 							for(loopcount=0;loopcount<8;loopcount++)
 							{
 								dat = (gfxdata & 0x0000000f)>>0; gfxdata >>=4;
-								if (dat) { if (!sprite_renderline[xxx]) { sprite_renderline[xxx] = dat | (colour<<4)| pri; } else { megadrive_sprite_collision = 1; } }
+								if (dat) { if (!sprite_renderline[xxx]) { sprite_renderline[xxx] = dat | (colour<<4)| pri; } else { megadrive_sprite_collision = 1; if (collision_only) return; } }
 								xxx++;xxx&=0x1ff;
 								if (--maxpixels == 0x00) return;
 							}
@@ -7523,6 +7542,76 @@ static void genesis_render_spriteline_to_spritebuffer(int scanline)
 	}
 }
 
+INLINE const UINT8 *genesis_get_decoded_tile_row(int tile_addr, int tile_dat)
+{
+	int row = (tile_addr>>1)&0x3fff;
+	UINT8 *decoded = &megadrive_vdp_tile_cache[row*16];
+
+	if (megadrive_vdp_tile_dirty[row])
+	{
+		UINT32 gfxdata = (MEGADRIV_VDP_VRAM(row*2+0)<<16)|MEGADRIV_VDP_VRAM(row*2+1);
+		int shift;
+
+		for (shift=0;shift<8;shift++)
+		{
+			decoded[shift] = (gfxdata>>(28-(shift*4)))&0x000f;
+			decoded[15-shift] = decoded[shift];
+		}
+		megadrive_vdp_tile_dirty[row] = 0;
+	}
+
+	return (tile_dat&0x0800) ? decoded+8 : decoded;
+}
+
+/* Draw pixels first to last-1 of one tile row of plane B, which goes down
+   first, so its high priority pixels can simply replace the buffer */
+INLINE int genesis_render_tile_span_b(int dpos, int tile_dat, int tile_addr, int first, int last)
+{
+	const UINT8 *decoded = genesis_get_decoded_tile_row(tile_addr, tile_dat);
+	UINT8 colour = (tile_dat&0x6000)>>9;
+	int shift;
+
+	if (!(tile_dat&0x8000))
+	{
+		for (shift=first;shift<last;shift++,dpos++)
+			if (decoded[shift]) video_renderline[dpos] = decoded[shift] | colour;
+	}
+	else
+	{
+		colour |= 0x80;
+		for (shift=first;shift<last;shift++,dpos++)
+			highpri_renderline[dpos] = decoded[shift] | colour;
+	}
+
+	return dpos;
+}
+
+/* As above for plane A and the window, where transparent high priority
+   pixels keep whatever plane B left behind */
+INLINE int genesis_render_tile_span_a(int dpos, int tile_dat, int tile_addr, int first, int last)
+{
+	const UINT8 *decoded = genesis_get_decoded_tile_row(tile_addr, tile_dat);
+	UINT8 colour = (tile_dat&0x6000)>>9;
+	int shift;
+
+	if (!(tile_dat&0x8000))
+	{
+		for (shift=first;shift<last;shift++,dpos++)
+			if (decoded[shift]) video_renderline[dpos] = decoded[shift] | colour;
+	}
+	else
+	{
+		colour |= 0x80;
+		for (shift=first;shift<last;shift++,dpos++)
+		{
+			if (decoded[shift]) highpri_renderline[dpos] = decoded[shift] | colour;
+			else highpri_renderline[dpos] |= 0x80;
+		}
+	}
+
+	return dpos;
+}
+
 /* Clean up this function (!) */
 static void genesis_render_videoline_to_videobuffer(int scanline)
 {
@@ -7741,11 +7830,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 				int tile_base;
 				int tile_dat;
 				int tile_addr;
-				int tile_xflip;
 				int tile_yflip;
-				int tile_colour;
-				int tile_pri;
-				int dat;
 
 				if (MEGADRIVE_REG0B_VSCROLL_MODE)
 				{
@@ -7774,10 +7859,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 
 				tile_base &=0x7fff;
 				tile_dat = MEGADRIV_VDP_VRAM(tile_base);
-				tile_xflip = (tile_dat&0x0800);
 				tile_yflip = (tile_dat&0x1000);
-				tile_colour =(tile_dat&0x6000)>>13;
-				tile_pri = (tile_dat&0x8000)>>15;
 				tile_addr = ((tile_dat&0x07ff)<<4);
 
 				if(megadrive_imode==3)
@@ -7793,28 +7875,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 					else tile_addr+=((7-vcolumn)&7)*2;
 				}
 
-				if (!tile_xflip)
-				{
-					/* 8 pixels */
-					UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-					int shift;
-
-					for (shift=hscroll_part;shift<8;shift++)
-					{
-						dat = (gfxdata>>(28-(shift*4)))&0x000f;  if (!tile_pri) { if(dat) video_renderline[dpos] = dat | (tile_colour<<4); }  else highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-						dpos++;
-					}
-				}
-				else
-				{
-					UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-					int shift;
-					for (shift=hscroll_part;shift<8;shift++)
-					{
-						dat = (gfxdata>>(shift*4) )&0x000f;  if (!tile_pri) { if(dat) video_renderline[dpos] = dat | (tile_colour<<4); }  else highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-						dpos++;
-					}
-				}
+				dpos = genesis_render_tile_span_b(dpos, tile_dat, tile_addr, hscroll_part, 8);
 
 				if (MEGADRIVE_REG0B_VSCROLL_MODE)
 				{
@@ -7841,10 +7902,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 
 				tile_base &=0x7fff;
 				tile_dat = MEGADRIV_VDP_VRAM(tile_base);
-				tile_xflip = (tile_dat&0x0800);
 				tile_yflip = (tile_dat&0x1000);
-				tile_colour =(tile_dat&0x6000)>>13;
-				tile_pri = (tile_dat&0x8000)>>15;
 				tile_addr = ((tile_dat&0x07ff)<<4);
 
 				if(megadrive_imode==3)
@@ -7861,28 +7919,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 					else tile_addr+=((7-vcolumn)&7)*2;
 				}
 
-				if (!tile_xflip)
-				{
-					/* 8 pixels */
-					UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-					int shift;
-
-					for (shift=0;shift<8;shift++)
-					{
-						dat = (gfxdata>>(28-(shift*4)))&0x000f;  if (!tile_pri) { if(dat) video_renderline[dpos] = dat | (tile_colour<<4); }  else highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-						dpos++;
-					}
-				}
-				else
-				{
-					UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-					int shift;
-					for (shift=0;shift<8;shift++)
-					{
-						dat = (gfxdata>>(shift*4))&0x000f;  if (!tile_pri) { if(dat) video_renderline[dpos] = dat | (tile_colour<<4); }  else highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-						dpos++;
-					}
-				}
+				dpos = genesis_render_tile_span_b(dpos, tile_dat, tile_addr, 0, 8);
 
 				if (MEGADRIVE_REG0B_VSCROLL_MODE)
 				{
@@ -7908,10 +7945,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 
 				tile_base &=0x7fff;
 				tile_dat = MEGADRIV_VDP_VRAM(tile_base);
-				tile_xflip = (tile_dat&0x0800);
 				tile_yflip = (tile_dat&0x1000);
-				tile_colour =(tile_dat&0x6000)>>13;
-				tile_pri = (tile_dat&0x8000)>>15;
 				tile_addr = ((tile_dat&0x07ff)<<4);
 
 				if(megadrive_imode==3)
@@ -7928,28 +7962,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 				}
 
 
-				if (!tile_xflip)
-				{
-					/* 8 pixels */
-					UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-					int shift;
-
-					for (shift=0;shift<(hscroll_part);shift++)
-					{
-						dat = (gfxdata>>(28-(shift*4)))&0x000f;  if (!tile_pri) { if(dat) video_renderline[dpos] = dat | (tile_colour<<4); }  else highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-						dpos++;
-					}
-				}
-				else
-				{
-					UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-					int shift;
-					for (shift=0;shift<(hscroll_part);shift++)
-					{
-						dat = (gfxdata>>(shift*4) )&0x000f;  if (!tile_pri) { if(dat) video_renderline[dpos] = dat | (tile_colour<<4); }  else highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-						dpos++;
-					}
-				}
+				dpos = genesis_render_tile_span_b(dpos, tile_dat, tile_addr, 0, hscroll_part);
 			}
 		}
 		/* END */
@@ -7969,11 +7982,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 			int tile_base;
 			int tile_dat;
 			int tile_addr;
-			int tile_xflip;
 			int tile_yflip;
-			int tile_colour;
-			int tile_pri;
-			int dat;
 
 			vcolumn = scanline&((window_vsize*8)-1);
 			dpos = column*16;
@@ -7990,10 +7999,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 
 			tile_base &=0x7fff;
 			tile_dat = MEGADRIV_VDP_VRAM(tile_base);
-			tile_xflip = (tile_dat&0x0800);
 			tile_yflip = (tile_dat&0x1000);
-			tile_colour =(tile_dat&0x6000)>>13;
-			tile_pri = (tile_dat&0x8000)>>15;
 			tile_addr = ((tile_dat&0x07ff)<<4);
 
 			if(megadrive_imode==3)
@@ -8013,47 +8019,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 				else tile_addr+=((7-vcolumn)&7)*2;
 			}
 
-			if (!tile_xflip)
-			{
-				/* 8 pixels */
-				UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-				int shift;
-
-				for (shift=0;shift<8;shift++)
-				{
-					dat = (gfxdata>>(28-(shift*4)))&0x000f;
-					if (!tile_pri)
-					{
-						if(dat) video_renderline[dpos] = dat | (tile_colour<<4);
-					}
-					else
-					{
-						if (dat) highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-						else highpri_renderline[dpos] = highpri_renderline[dpos]|0x80;
-					}
-					dpos++;
-				}
-			}
-			else
-			{
-				UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-				int shift;
-				for (shift=0;shift<8;shift++)
-				{
-					dat = (gfxdata>>(shift*4) )&0x000f;
-					if (!tile_pri)
-					{
-						if(dat) video_renderline[dpos] = dat | (tile_colour<<4);
-					}
-					else
-					{
-						if (dat) highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-						else highpri_renderline[dpos] = highpri_renderline[dpos]|0x80;
-					}
-					dpos++;
-
-				}
-			}
+			dpos = genesis_render_tile_span_a(dpos, tile_dat, tile_addr, 0, 8);
 
 
 			hcolumn = (column*2+1)&(window_hsize-1);
@@ -8067,10 +8033,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 			}
 			tile_base &=0x7fff;
 			tile_dat = MEGADRIV_VDP_VRAM(tile_base);
-			tile_xflip = (tile_dat&0x0800);
 			tile_yflip = (tile_dat&0x1000);
-			tile_colour =(tile_dat&0x6000)>>13;
-			tile_pri = (tile_dat&0x8000)>>15;
 			tile_addr = ((tile_dat&0x07ff)<<4);
 
 			if(megadrive_imode==3)
@@ -8090,46 +8053,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 				else tile_addr+=((7-vcolumn)&7)*2;
 			}
 
-			if (!tile_xflip)
-			{
-				/* 8 pixels */
-				UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-				int shift;
-
-				for (shift=0;shift<8;shift++)
-				{
-					dat = (gfxdata>>(28-(shift*4)))&0x000f;
-					if (!tile_pri)
-					{
-						if(dat) video_renderline[dpos] = dat | (tile_colour<<4);
-					}
-					else
-					{
-						if (dat) highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-						else highpri_renderline[dpos] = highpri_renderline[dpos]|0x80;
-					}
-					dpos++;
-				}
-			}
-			else
-			{
-				UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-				int shift;
-				for (shift=0;shift<8;shift++)
-				{
-					dat = (gfxdata>>(shift*4) )&0x000f;
-					if (!tile_pri)
-					{
-						if(dat) video_renderline[dpos] = dat | (tile_colour<<4);
-					}
-					else
-					{
-						if (dat) highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-						else highpri_renderline[dpos] = highpri_renderline[dpos]|0x80;
-					}
-					dpos++;
-				}
-			}
+			dpos = genesis_render_tile_span_a(dpos, tile_dat, tile_addr, 0, 8);
 		}
 
 		/* Non Window Part */
@@ -8148,11 +8072,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 				int tile_base;
 				int tile_dat;
 				int tile_addr;
-				int tile_xflip;
 				int tile_yflip;
-				int tile_colour;
-				int tile_pri;
-				int dat;
 
 				if (MEGADRIVE_REG0B_VSCROLL_MODE)
 				{
@@ -8189,10 +8109,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 
 				tile_base &=0x7fff;
 				tile_dat = MEGADRIV_VDP_VRAM(tile_base);
-				tile_xflip = (tile_dat&0x0800);
 				tile_yflip = (tile_dat&0x1000);
-				tile_colour =(tile_dat&0x6000)>>13;
-				tile_pri = (tile_dat&0x8000)>>15;
 				tile_addr = ((tile_dat&0x07ff)<<4);
 
 				if(megadrive_imode==3)
@@ -8208,46 +8125,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 					else tile_addr+=((7-vcolumn)&7)*2;
 				}
 
-				if (!tile_xflip)
-				{
-					/* 8 pixels */
-					UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-					int shift;
-
-					for (shift=hscroll_part;shift<8;shift++)
-					{
-						dat = (gfxdata>>(28-(shift*4)))&0x000f;
-						if (!tile_pri)
-						{
-							if(dat) video_renderline[dpos] = dat | (tile_colour<<4);
-						}
-						else
-						{
-							if (dat) highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-							else highpri_renderline[dpos] = highpri_renderline[dpos]|0x80;
-						}
-						dpos++;
-					}
-				}
-				else
-				{
-					UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-					int shift;
-					for (shift=hscroll_part;shift<8;shift++)
-					{
-						dat = (gfxdata>>(shift*4) )&0x000f;
-						if (!tile_pri)
-						{
-							if(dat) video_renderline[dpos] = dat | (tile_colour<<4);
-						}
-						else
-						{
-							if (dat) highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-							else highpri_renderline[dpos] = highpri_renderline[dpos]|0x80;
-						}
-						dpos++;
-					}
-				}
+				dpos = genesis_render_tile_span_a(dpos, tile_dat, tile_addr, hscroll_part, 8);
 
 				if (MEGADRIVE_REG0B_VSCROLL_MODE)
 				{
@@ -8280,10 +8158,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 
 				tile_base &=0x7fff;
 				tile_dat = MEGADRIV_VDP_VRAM(tile_base);
-				tile_xflip = (tile_dat&0x0800);
 				tile_yflip = (tile_dat&0x1000);
-				tile_colour =(tile_dat&0x6000)>>13;
-				tile_pri = (tile_dat&0x8000)>>15;
 				tile_addr = ((tile_dat&0x07ff)<<4);
 
 
@@ -8300,46 +8175,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 					else tile_addr+=((7-vcolumn)&7)*2;
 				}
 
-				if (!tile_xflip)
-				{
-					/* 8 pixels */
-					UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-					int shift;
-
-					for (shift=0;shift<8;shift++)
-					{
-						dat = (gfxdata>>(28-(shift*4)))&0x000f;
-						if (!tile_pri)
-						{
-							if(dat) video_renderline[dpos] = dat | (tile_colour<<4);
-						}
-						else
-						{
-							if (dat) highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-							else highpri_renderline[dpos] = highpri_renderline[dpos]|0x80;
-						}
-						dpos++;
-					}
-				}
-				else
-				{
-					UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-					int shift;
-					for (shift=0;shift<8;shift++)
-					{
-						dat = (gfxdata>>(shift*4) )&0x000f;
-						if (!tile_pri)
-						{
-							if(dat) video_renderline[dpos] = dat | (tile_colour<<4);
-						}
-						else
-						{
-							if (dat) highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-							else highpri_renderline[dpos] = highpri_renderline[dpos]|0x80;
-						}
-						dpos++;
-					}
-				}
+				dpos = genesis_render_tile_span_a(dpos, tile_dat, tile_addr, 0, 8);
 
 				if (MEGADRIVE_REG0B_VSCROLL_MODE)
 				{
@@ -8365,10 +8201,7 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 				}
 				tile_base &=0x7fff;
 				tile_dat = MEGADRIV_VDP_VRAM(tile_base);
-				tile_xflip = (tile_dat&0x0800);
 				tile_yflip = (tile_dat&0x1000);
-				tile_colour =(tile_dat&0x6000)>>13;
-				tile_pri = (tile_dat&0x8000)>>15;
 				tile_addr = ((tile_dat&0x07ff)<<4);
 
 				if(megadrive_imode==3)
@@ -8388,162 +8221,106 @@ static void genesis_render_videoline_to_videobuffer(int scanline)
 					else tile_addr+=((7-vcolumn)&7)*2;
 				}
 
-				if (!tile_xflip)
-				{
-					/* 8 pixels */
-					UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-					int shift;
-
-					for (shift=0;shift<(hscroll_part);shift++)
-					{
-						dat = (gfxdata>>(28-(shift*4)))&0x000f;
-						if (!tile_pri)
-						{
-							if(dat) video_renderline[dpos] = dat | (tile_colour<<4);
-						}
-						else
-						{
-							if (dat) highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-							else highpri_renderline[dpos] = highpri_renderline[dpos]|0x80;
-						}
-						dpos++;
-					}
-				}
-				else
-				{
-					UINT32 gfxdata = (MEGADRIV_VDP_VRAM(tile_addr+0)<<16)|MEGADRIV_VDP_VRAM(tile_addr+1);
-					int shift;
-					for (shift=0;shift<(hscroll_part);shift++)
-					{
-						dat = (gfxdata>>(shift*4) )&0x000f;
-						if (!tile_pri)
-						{
-							if(dat) video_renderline[dpos] = dat | (tile_colour<<4);
-						}
-						else
-						{
-							if (dat) highpri_renderline[dpos]  = dat | (tile_colour<<4) | 0x80;
-							else highpri_renderline[dpos] = highpri_renderline[dpos]|0x80;
-						}
-						dpos++;
-					}
-				}
+				dpos = genesis_render_tile_span_a(dpos, tile_dat, tile_addr, 0, hscroll_part);
 			}
 		}
 	}
 		/* END */
 
-/* MEGADRIVE_REG0C_SHADOW_HIGLIGHT */
-		/* Low Priority Sprites */
+	/* Merge the sprites and the high priority tiles into the line */
+	if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
+	{
+		/* without shadow / highlight the top layer simply wins: high priority
+           sprites, then opaque high priority tiles, then low priority sprites */
 		for (x=0;x<320;x++)
 		{
-			if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
-			{
-				if (sprite_renderline[x+128] & 0x40)
-				{
-					video_renderline[x] = sprite_renderline[x+128]&0x3f;
-					video_renderline[x] |= 0x10000; // mark as sprite pixel
-				}
-			}
-			else
-			{	/* Special Shadow / Highlight processing */
+			UINT8 spritedata = sprite_renderline[x+128];
+			UINT8 dat = highpri_renderline[x];
 
-				if (sprite_renderline[x+128] & 0x40)
-				{
-					UINT8 spritedata;
-					spritedata = sprite_renderline[x+128]&0x3f;
+			if (spritedata & 0x80)
+				video_renderline[x] = (spritedata&0x3f) | 0x10000; // mark as sprite pixel
+			else if ((dat&0x80) && (dat&0x0f))
+				video_renderline[x] = dat&0x3f;
+			else if (spritedata & 0x40)
+				video_renderline[x] = (spritedata&0x3f) | 0x10000; // mark as sprite pixel
+		}
+		return;
+	}
 
-					if ((spritedata==0x0e) || (spritedata==0x1e) || (spritedata==0x2e))
-					{
-						/* BUG in sprite chip, these colours are always normal intensity */
-						video_renderline[x] = spritedata | 0x4000;
-						video_renderline[x] |= 0x10000; // mark as sprite pixel
-					}
-					else if (spritedata==0x3e)
-					{
-						/* Everything below this is half colour, mark with 0x8000 to mark highlight' */
-						video_renderline[x] = video_renderline[x]|0x8000; // spiderwebs..
-					}
-					else if (spritedata==0x3f)
-					{
-						/* This is a Shadow operator, but everything below is already low pri, no effect */
-						video_renderline[x] = video_renderline[x]|0x2000;
+	/* Special Shadow / Highlight processing */
 
-					}
-					else
-					{
-						video_renderline[x] = spritedata;
-						video_renderline[x] |= 0x10000; // mark as sprite pixel
-					}
+	/* Low Priority Sprites */
+	for (x=0;x<320;x++)
+	{
+		if (sprite_renderline[x+128] & 0x40)
+		{
+			UINT8 spritedata;
+			spritedata = sprite_renderline[x+128]&0x3f;
 
-				}
+			if ((spritedata==0x0e) || (spritedata==0x1e) || (spritedata==0x2e))
+			{
+				/* BUG in sprite chip, these colours are always normal intensity */
+				video_renderline[x] = spritedata | 0x4000;
+				video_renderline[x] |= 0x10000; // mark as sprite pixel
 			}
-		}
-		/* High Priority A+B Tiles */
-		for (x=0;x<320;x++)
-		{
-			if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
+			else if (spritedata==0x3e)
+			{
+				/* Everything below this is half colour, mark with 0x8000 to mark highlight' */
+				video_renderline[x] = video_renderline[x]|0x8000; // spiderwebs..
+			}
+			else if (spritedata==0x3f)
 			{
-				/* Normal Processing */
-				int dat;
-				dat = highpri_renderline[x];
+				/* This is a Shadow operator, but everything below is already low pri, no effect */
+				video_renderline[x] = video_renderline[x]|0x2000;
 
-				if (dat&0x80)
-				{
-					 if (dat&0x0f) video_renderline[x] = highpri_renderline[x]&0x3f;
-				}
 			}
 			else
 			{
-				/* Shadow / Highlight Mode */
-				int dat;
-				dat = highpri_renderline[x];
-
-				if (dat&0x80)
-				{
-					 if (dat&0x0f) video_renderline[x] = (highpri_renderline[x]&0x3f) | 0x4000;
-					 else video_renderline[x] = video_renderline[x] | 0x4000; // set 'normal'
-				}
+				video_renderline[x] = spritedata;
+				video_renderline[x] |= 0x10000; // mark as sprite pixel
 			}
+
 		}
+	}
 
-		/* High Priority Sprites */
-		for (x=0;x<320;x++)
+	/* High Priority A+B Tiles */
+	for (x=0;x<320;x++)
+	{
+		int dat;
+		dat = highpri_renderline[x];
+
+		if (dat&0x80)
 		{
-			if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
+			 if (dat&0x0f) video_renderline[x] = (highpri_renderline[x]&0x3f) | 0x4000;
+			 else video_renderline[x] = video_renderline[x] | 0x4000; // set 'normal'
+		}
+	}
+
+	/* High Priority Sprites */
+	for (x=0;x<320;x++)
+	{
+		if (sprite_renderline[x+128] & 0x80)
+		{
+			UINT8 spritedata;
+			spritedata = sprite_renderline[x+128]&0x3f;
+
+			if (spritedata==0x3e)
 			{
-				/* Normal */
-				if (sprite_renderline[x+128] & 0x80)
-				{
-					video_renderline[x] = sprite_renderline[x+128]&0x3f;
-					video_renderline[x] |= 0x10000; // mark as sprite pixel
-				}
+				/* set flag 0x8000 to indicate highlight */
+				video_renderline[x] = video_renderline[x]|0x8000;
+			}
+			else if (spritedata==0x3f)
+			{
+				/* This is a Shadow operator set shadow bit */
+				video_renderline[x] = video_renderline[x]|0x2000;
 			}
 			else
 			{
-				if (sprite_renderline[x+128] & 0x80)
-				{
-					UINT8 spritedata;
-					spritedata = sprite_renderline[x+128]&0x3f;
-
-					if (spritedata==0x3e)
-					{
-						/* set flag 0x8000 to indicate highlight */
-						video_renderline[x] = video_renderline[x]|0x8000;
-					}
-					else if (spritedata==0x3f)
-					{
-						/* This is a Shadow operator set shadow bit */
-						video_renderline[x] = video_renderline[x]|0x2000;
-					}
-					else
-					{
-						video_renderline[x] = spritedata | 0x4000;
-						video_renderline[x] |= 0x10000; // mark as sprite pixel
-					}
-				}
+				video_renderline[x] = spritedata | 0x4000;
+				video_renderline[x] |= 0x10000; // mark as sprite pixel
 			}
 		}
+	}
 }
 
 static UINT32 _32x_linerender[320+258]; // tmp buffer (bigger than it needs to be to simplify RLE decode)
@@ -8661,7 +8438,15 @@ static void genesis_render_videobuffer_to_screenbuffer(running_machine &machine,
 	int _32x_priority = _32x_videopriority;
 
 
-	if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
+	if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT && genvdp_use_cram && !(_32x_is_connected && (_32x_displaymode != 0)))
+	{
+		/* plain Genesis line: the sprite and background lookups are the same
+           table and the C2 palette banking isn't in use, so it's a straight
+           CRAM lookup for every pixel */
+		for (x=0;x<320;x++)
+			lineptr[x] = megadrive_vdp_palette_lookup[video_renderline[x]&0x3f];
+	}
+	else if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
 	{
 
 		for (x=0;x<320;x++)
@@ -8805,7 +8590,14 @@ static void genesis_render_videobuffer_to_screenbuffer(running_machine &machine,
 static void genesis_render_scanline(running_machine &machine, int scanline)
 {
 	//if (MEGADRIVE_REG01_DMA_ENABLE==0) mame_printf_debug("off\n");
-	genesis_render_spriteline_to_spritebuffer(genesis_scanline_counter);
+	int skip = machine.video().skip_drawing();
+
+	/* a skipped frame still needs the sprite collision flag, but nothing
+       else drawn in it would be seen */
+	genesis_render_spriteline_to_spritebuffer(genesis_scanline_counter, skip);
+	if (skip)
+		return;
+
 	genesis_render_videoline_to_videobuffer(scanline);
 	genesis_render_videobuffer_to_screenbuffer(machine, scanline);
 }
@@ -25,6 +25,10 @@ CPUS += M680X0
 CPUS += SH2
 CPUS += SSP1601
 
+# the Mega Drive drivers only use a plain 68000, so leave the other
+# family members' opcode handlers and cycle tables out of the build
+M68K_SINGLE_CPU = 000
+
 
 #-------------------------------------------------
 # Specify all the sound cores necessary for the
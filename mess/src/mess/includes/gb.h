@@ -37,6 +37,7 @@
 
 
 #define _NR_GB_VID_REGS		0x40
+#define GB_TILES_PER_BANK	0x180	/* 0x1800 bytes of tile data in each VRAM bank */
 
 struct layer_struct {
 	UINT8  enabled;
@@ -101,6 +102,14 @@ typedef struct {
 	UINT8	*gbc_chrgen;	/* CGB Character generator */
 	UINT8	*gbc_bgdtab;	/* CGB Background character table */
 	UINT8	*gbc_wndtab;	/* CGB Window character table */
+
+	/* Tile data decoded to one palette index per pixel, redone when dirty */
+	UINT8	tile_pixels[2 * GB_TILES_PER_BANK][64];
+	UINT8	tile_dirty[2 * GB_TILES_PER_BANK];
+
+	/* Sprites on each OAM line (bit n = sprite n), kept up to date on OAM writes */
+	UINT64	sprite_lines[256];
+	int	sprite_height;		/* Height sprite_lines was built for, 0 to rebuild */
 } gb_lcd_t;
 
 
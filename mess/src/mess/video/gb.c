@@ -155,14 +155,98 @@ INLINE void gb_plot_pixel(bitmap_t *bitmap, int x, int y, UINT32 color)
 	*BITMAP_ADDR16(bitmap, y, x) = (UINT16)color;
 }
 
+/*
+  Decode all 8 rows of a tile into palette indices. Tiles are numbered
+  GB_TILES_PER_BANK per VRAM bank.
+ */
+static void gb_decode_tile( gb_lcd_t *lcd, int tile )
+{
+	const UINT8 *src = lcd->gb_vram->base() + ( tile / GB_TILES_PER_BANK ) * 0x2000 + ( tile % GB_TILES_PER_BANK ) * 16;
+	UINT8 *dst = lcd->tile_pixels[tile];
+	int row, bit;
+
+	for ( row = 0; row < 8; row++, src += 2 )
+	{
+		for ( bit = 7; bit >= 0; bit-- )
+			*dst++ = ( ( src[0] >> bit ) & 1 ) | ( ( ( src[1] >> bit ) & 1 ) << 1 );
+	}
+	lcd->tile_dirty[tile] = 0;
+}
+
+/* Return the 8 decoded pixels of one row of a tile */
+INLINE const UINT8 *gb_tile_row( gb_lcd_t *lcd, int tile, int row )
+{
+	if ( lcd->tile_dirty[tile] )
+		gb_decode_tile( lcd, tile );
+	return lcd->tile_pixels[tile] + row * 8;
+}
+
+/* Number of the first tile a character generator pointer refers to */
+INLINE int gb_tile_base( gb_lcd_t *lcd, const UINT8 *chrgen )
+{
+	int offset = chrgen - lcd->gb_vram->base();
+	return ( offset >> 13 ) * GB_TILES_PER_BANK + ( ( offset & 0x1FFF ) >> 4 );
+}
+
+/* Decoded pixels of the row of a sprite that falls on line */
+INLINE const UINT8 *gb_sprite_row( gb_lcd_t *lcd, const UINT8 *oam, int bank, UINT8 line, UINT8 height, UINT8 tilemask )
+{
+	int row;
+
+	if ( oam[3] & 0x40 )		/* flip y ? */
+		row = height - 1 - line + oam[0];
+	else
+		row = line - oam[0];
+	return gb_tile_row( lcd, bank * GB_TILES_PER_BANK + ( oam[2] & tilemask ) + ( row >> 3 ), row & 7 );
+}
+
+/* Add sprite i to, or remove it from, the lines it covers in sprite_lines */
+static void gb_sprite_lines_update( gb_lcd_t *lcd, int i, int add )
+{
+	const UINT8 *oam = lcd->gb_oam->base() + i * 4;
+	UINT64 bit = (UINT64)1 << i;
+	int y, y_end;
+
+	/* sprites at x-coordinate 0 or >= 168 are never drawn */
+	if ( ! oam[1] || oam[1] >= 168 )
+		return;
+
+	y_end = MIN( oam[0] + lcd->sprite_height, 256 );
+	for ( y = oam[0]; y < y_end; y++ )
+	{
+		if ( add )
+			lcd->sprite_lines[y] |= bit;
+		else
+			lcd->sprite_lines[y] &= ~bit;
+	}
+}
+
+/*
+  Return the sprites on the given OAM line (current line + 16), rebuilding
+  the per line table if OAM was replaced or the sprite height changed.
+ */
+INLINE UINT64 gb_sprites_on_line( gb_lcd_t *lcd, UINT8 line, UINT8 height )
+{
+	if ( lcd->sprite_height != height )
+	{
+		int i;
+
+		memset( lcd->sprite_lines, 0, sizeof( lcd->sprite_lines ) );
+		lcd->sprite_height = height;
+		for ( i = 0; i < 40; i++ )
+			gb_sprite_lines_update( lcd, i, 1 );
+	}
+	return lcd->sprite_lines[line];
+}
+
 /*
   Select which sprites should be drawn for the current scanline and return the
   number of sprites selected.
  */
 static void gb_select_sprites( gb_state *state )
 {
-	int	i, /*yindex,*/ line, height;
-	UINT8	*oam = state->m_lcd.gb_oam->base() + 39 * 4;
+	int	i;
+	UINT64	sprites;
 
 	state->m_lcd.sprCount = 0;
 
@@ -170,31 +254,20 @@ static void gb_select_sprites( gb_state *state )
 	if ( ( LCDCONT & 0x80 ) && ( LCDCONT & 0x02 ) )
 	{
 		/* Check for stretched sprites */
-		if ( LCDCONT & 0x04 )
-		{
-			height = 16;
-		}
-		else
-		{
-			height = 8;
-		}
-
-		//yindex = state->m_lcd.current_line;
-		line = state->m_lcd.current_line + 16;
+		sprites = gb_sprites_on_line( &state->m_lcd, state->m_lcd.current_line + 16, ( LCDCONT & 0x04 ) ? 16 : 8 );
 
-		for( i = 39; i >= 0; i-- )
+		for( i = 39; i >= 0 && sprites; i-- )
 		{
-			if ( line >= oam[0] && line < ( oam[0] + height ) && oam[1] && oam[1] < 168 )
+			if ( sprites & ( (UINT64)1 << i ) )
 			{
 				/* We limit the sprite count to max 10 here;
                    proper games should not exceed this... */
-				if ( state->m_lcd.sprCount < 10 )
-				{
-					state->m_lcd.sprite[state->m_lcd.sprCount] = i;
-					state->m_lcd.sprCount++;
-				}
+				if ( state->m_lcd.sprCount == 10 )
+					break;
+				state->m_lcd.sprite[state->m_lcd.sprCount] = i;
+				state->m_lcd.sprCount++;
+				sprites &= ~( (UINT64)1 << i );
 			}
-			oam -= 4;
 		}
 	}
 }
@@ -203,8 +276,10 @@ INLINE void gb_update_sprites ( running_machine &machine )
 {
 	gb_state *state = machine.driver_data<gb_state>();
 	bitmap_t *bitmap = machine.generic.tmpbitmap;
-	UINT8 height, tilemask, line, *oam, *vram;
-	int i, yindex;
+	UINT16 *dest = BITMAP_ADDR16(bitmap, state->m_lcd.current_line, 0);
+	UINT8 height, tilemask, line, *oam;
+	UINT64 sprites;
+	int i;
 
 	if (LCDCONT & 0x04)
 	{
@@ -217,73 +292,43 @@ INLINE void gb_update_sprites ( running_machine &machine )
 		tilemask = 0xFF;
 	}
 
-	yindex = state->m_lcd.current_line;
 	line = state->m_lcd.current_line + 16;
+	sprites = gb_sprites_on_line(&state->m_lcd, line, height);
 
-	oam = state->m_lcd.gb_oam->base() + 39 * 4;
-	vram = state->m_lcd.gb_vram->base();
-	for (i = 39; i >= 0; i--)
+	for (i = 39; sprites; i--)
 	{
-		/* if sprite is on current line && x-coordinate && x-coordinate is < 168 */
-		if (line >= oam[0] && line < (oam[0] + height) && oam[1] && oam[1] < 168)
+		const UINT8 *pix, *spal;
+		int xindex, bit, bit_end, step;
+
+		if (!(sprites & ((UINT64)1 << i)))
+			continue;
+		sprites &= ~((UINT64)1 << i);
+
+		oam = state->m_lcd.gb_oam->base() + i * 4;
+		spal = (oam[3] & 0x10) ? state->m_lcd.gb_spal1 : state->m_lcd.gb_spal0;
+		pix = gb_sprite_row(&state->m_lcd, oam, 0, line, height, tilemask);
+		step = 1;
+		if (oam[3] & 0x20)			/* flip x ? */
 		{
-			UINT16 data;
-			UINT8 bit, *spal;
-			int xindex, adr;
+			pix += 7;
+			step = -1;
+		}
 
-			spal = (oam[3] & 0x10) ? state->m_lcd.gb_spal1 : state->m_lcd.gb_spal0;
-			xindex = oam[1] - 8;
-			if (oam[3] & 0x40)		   /* flip y ? */
-			{
-				adr = (oam[2] & tilemask) * 16 + (height - 1 - line + oam[0]) * 2;
-			}
-			else
-			{
-				adr = (oam[2] & tilemask) * 16 + (line - oam[0]) * 2;
-			}
-			data = (vram[adr + 1] << 8) | vram[adr];
+		/* only the part of the sprite inside the screen is drawn */
+		xindex = oam[1] - 8;
+		bit = (xindex < 0) ? -xindex : 0;
+		bit_end = MIN(8, 160 - xindex);
 
-			switch (oam[3] & 0xA0)
-			{
-			case 0xA0:				   /* priority is set (behind bgnd & wnd, flip x) */
-				for (bit = 0; bit < 8; bit++, xindex++)
-				{
-					register int colour = ((data & 0x0100) ? 2 : 0) | ((data & 0x0001) ? 1 : 0);
-					if (colour && !state->m_lcd.bg_zbuf[xindex] && xindex >= 0 && xindex < 160)
-						gb_plot_pixel(bitmap, xindex, yindex, spal[colour]);
-					data >>= 1;
-				}
-				break;
-			case 0x20:				   /* priority is not set (overlaps bgnd & wnd, flip x) */
-				for (bit = 0; bit < 8; bit++, xindex++)
-				{
-					register int colour = ((data & 0x0100) ? 2 : 0) | ((data & 0x0001) ? 1 : 0);
-					if (colour && xindex >= 0 && xindex < 160)
-						gb_plot_pixel(bitmap, xindex, yindex, spal[colour]);
-					data >>= 1;
-				}
-				break;
-			case 0x80:				   /* priority is set (behind bgnd & wnd, don't flip x) */
-				for (bit = 0; bit < 8 && xindex < 160; bit++, xindex++)
-				{
-					register int colour = ((data & 0x8000) ? 2 : 0) | ((data & 0x0080) ? 1 : 0);
-					if (colour && !state->m_lcd.bg_zbuf[xindex] && xindex >= 0 && xindex < 160)
-						gb_plot_pixel(bitmap, xindex, yindex, spal[colour]);
-					data <<= 1;
-				}
-				break;
-			case 0x00:				   /* priority is not set (overlaps bgnd & wnd, don't flip x) */
-				for (bit = 0; bit < 8 && xindex < 160; bit++, xindex++)
-				{
-					register int colour = ((data & 0x8000) ? 2 : 0) | ((data & 0x0080) ? 1 : 0);
-					if (colour && xindex >= 0 && xindex < 160)
-						gb_plot_pixel(bitmap, xindex, yindex, spal[colour]);
-					data <<= 1;
-				}
-				break;
-			}
+		for (; bit < bit_end; bit++)
+		{
+			int colour = pix[bit * step];
+
+			/* priority is set (behind bgnd & wnd) */
+			if ((oam[3] & 0x80) && state->m_lcd.bg_zbuf[xindex + bit])
+				continue;
+			if (colour)
+				dest[xindex + bit] = spal[colour];
 		}
-		oam -= 4;
 	}
 }
 
@@ -345,6 +390,16 @@ static void gb_update_scanline( running_machine &machine )
 		if ( cycles_to_go < 160 )
 		{
 			state->m_lcd.end_x = MIN(160 - cycles_to_go,160);
+
+			/* Nothing drawn in a skipped frame is seen; the layers are
+               still set up above so the window line count stays right */
+			if ( machine.video().skip_drawing() )
+			{
+				state->m_lcd.start_x = state->m_lcd.end_x;
+				g_profiler.stop();
+				return;
+			}
+
 			/* Draw empty pixels when the background is disabled */
 			if ( ! ( LCDCONT & 0x01 ) )
 			{
@@ -356,9 +411,10 @@ static void gb_update_scanline( running_machine &machine )
 			}
 			while ( l < 2 )
 			{
-				UINT8	xindex, *map, *tiles;
-				UINT16	data;
-				int	i, tile_index;
+				UINT8	xindex, *map;
+				UINT16	*dest = BITMAP_ADDR16( bitmap, state->m_lcd.current_line, 0 );
+				const UINT8	*pix;
+				int	i, tile_base;
 
 				if ( ! state->m_lcd.layer[l].enabled )
 				{
@@ -366,7 +422,7 @@ static void gb_update_scanline( running_machine &machine )
 					continue;
 				}
 				map = state->m_lcd.layer[l].bg_map + ( ( state->m_lcd.layer[l].bgline << 2 ) & 0x3E0 );
-				tiles = state->m_lcd.layer[l].bg_tiles + ( ( state->m_lcd.layer[l].bgline & 7 ) << 1 );
+				tile_base = gb_tile_base( &state->m_lcd, state->m_lcd.layer[l].bg_tiles );
 				xindex = state->m_lcd.start_x;
 				if ( xindex < state->m_lcd.layer[l].xstart )
 					xindex = state->m_lcd.layer[l].xstart;
@@ -375,21 +431,24 @@ static void gb_update_scanline( running_machine &machine )
 					i = state->m_lcd.layer[l].xend;
 				i = i - xindex;
 
-				tile_index = ( map[ state->m_lcd.layer[l].xindex ] ^ state->m_lcd.gb_tile_no_mod ) * 16;
-				data = tiles[ tile_index ] | ( tiles[ tile_index+1 ] << 8 );
-				data <<= state->m_lcd.layer[l].xshift;
+				pix = gb_tile_row( &state->m_lcd, tile_base + ( map[ state->m_lcd.layer[l].xindex ] ^ state->m_lcd.gb_tile_no_mod ), state->m_lcd.layer[l].bgline & 7 );
 
 				while ( i > 0 )
 				{
-					while ( ( state->m_lcd.layer[l].xshift < 8 ) && i )
+					/* Draw what is left of the current tile row as one run */
+					int	n = 8 - state->m_lcd.layer[l].xshift;
+					const UINT8	*run = pix + state->m_lcd.layer[l].xshift;
+
+					if ( n > i )
+						n = i;
+					state->m_lcd.layer[l].xshift += n;
+					i -= n;
+					while ( n-- > 0 )
 					{
-						register int colour = ( ( data & 0x8000 ) ? 2 : 0 ) | ( ( data & 0x0080 ) ? 1 : 0 );
-						gb_plot_pixel( bitmap, xindex, state->m_lcd.current_line, state->m_lcd.gb_bpal[ colour ] );
+						register int colour = *run++;
+						dest[ xindex ] = state->m_lcd.gb_bpal[ colour ];
 						state->m_lcd.bg_zbuf[ xindex ] = colour;
 						xindex++;
-						data <<= 1;
-						state->m_lcd.layer[l].xshift++;
-						i--;
 					}
 					if ( state->m_lcd.layer[l].xshift == 8 )
 					{
@@ -398,13 +457,11 @@ static void gb_update_scanline( running_machine &machine )
 						{
 							state->m_lcd.layer[0].bgline = ( SCROLLY + state->m_lcd.current_line ) & 0xFF;
 							map = state->m_lcd.layer[l].bg_map + ( ( state->m_lcd.layer[l].bgline << 2 ) & 0x3E0 );
-							tiles = state->m_lcd.layer[l].bg_tiles + ( ( state->m_lcd.layer[l].bgline & 7 ) << 1 );
 						}
 
 						state->m_lcd.layer[l].xindex = ( state->m_lcd.layer[l].xindex + 1 ) & 31;
 						state->m_lcd.layer[l].xshift = 0;
-						tile_index = ( map[ state->m_lcd.layer[l].xindex ] ^ state->m_lcd.gb_tile_no_mod ) * 16;
-						data = tiles[ tile_index ] | ( tiles[ tile_index+1 ] << 8 );
+						pix = gb_tile_row( &state->m_lcd, tile_base + ( map[ state->m_lcd.layer[l].xindex ] ^ state->m_lcd.gb_tile_no_mod ), state->m_lcd.layer[l].bgline & 7 );
 					}
 				}
 				l++;
@@ -447,7 +504,9 @@ INLINE void sgb_update_sprites (running_machine &machine)
 {
 	gb_state *state = machine.driver_data<gb_state>();
 	bitmap_t *bitmap = machine.generic.tmpbitmap;
-	UINT8 height, tilemask, line, *oam, *vram, pal;
+	UINT8 height, tilemask, line, *oam, pal;
+	UINT16 *dest;
+	UINT64 sprites;
 	INT16 i, yindex;
 
 	if (LCDCONT & 0x04)
@@ -464,78 +523,47 @@ INLINE void sgb_update_sprites (running_machine &machine)
 	/* Offset to center of screen */
 	yindex = state->m_lcd.current_line + SGB_YOFFSET;
 	line = state->m_lcd.current_line + 16;
+	dest = BITMAP_ADDR16(bitmap, yindex, SGB_XOFFSET);
 
-	oam = state->m_lcd.gb_oam->base() + 39 * 4;
-	vram = state->m_lcd.gb_vram->base();
-	for (i = 39; i >= 0; i--)
+	sprites = gb_sprites_on_line(&state->m_lcd, line, height);
+	for (i = 39; sprites; i--)
 	{
-		/* if sprite is on current line && x-coordinate && x-coordinate is < 168 */
-		if (line >= oam[0] && line < (oam[0] + height) && oam[1] && oam[1] < 168)
+		const UINT8 *pix, *spal;
+		INT16 xindex;
+		int bit, bit_end, step;
+
+		if (!(sprites & ((UINT64)1 << i)))
+			continue;
+		sprites &= ~((UINT64)1 << i);
+
+		oam = state->m_lcd.gb_oam->base() + i * 4;
+		spal = (oam[3] & 0x10) ? state->m_lcd.gb_spal1 : state->m_lcd.gb_spal0;
+		pix = gb_sprite_row(&state->m_lcd, oam, 0, line, height, tilemask);
+		step = 1;
+		if (oam[3] & 0x20)			/* flip x ? */
 		{
-			UINT16 data;
-			UINT8 bit, *spal;
-			INT16 xindex;
-			int adr;
+			pix += 7;
+			step = -1;
+		}
+		xindex = oam[1] - 8;
 
-			spal = (oam[3] & 0x10) ? state->m_lcd.gb_spal1 : state->m_lcd.gb_spal0;
-			xindex = oam[1] - 8;
-			if (oam[3] & 0x40)		   /* flip y ? */
-			{
-				adr = (oam[2] & tilemask) * 16 + (height -1 - line + oam[0]) * 2;
-			}
-			else
-			{
-				adr = (oam[2] & tilemask) * 16 + (line - oam[0]) * 2;
-			}
-			data = (vram[adr + 1] << 8) | vram[adr];
+		/* Find the palette to use */
+		pal = state->m_sgb_pal_map[(xindex >> 3)][((yindex - SGB_YOFFSET) >> 3)] << 2;
 
-			/* Find the palette to use */
-			pal = state->m_sgb_pal_map[(xindex >> 3)][((yindex - SGB_YOFFSET) >> 3)] << 2;
+		/* only the part of the sprite inside the screen is drawn */
+		bit = (xindex < 0) ? -xindex : 0;
+		bit_end = MIN(8, 160 - xindex);
 
-			/* Offset to center of screen */
-			xindex += SGB_XOFFSET;
+		for (; bit < bit_end; bit++)
+		{
+			int colour = pix[bit * step];
 
-			switch (oam[3] & 0xA0)
-			{
-			case 0xA0:				   /* priority is set (behind bgnd & wnd, flip x) */
-				for (bit = 0; bit < 8; bit++, xindex++)
-				{
-					register int colour = ((data & 0x0100) ? 2 : 0) | ((data & 0x0001) ? 1 : 0);
-					if ((xindex >= SGB_XOFFSET && xindex < SGB_XOFFSET + 160) && colour && !state->m_lcd.bg_zbuf[xindex - SGB_XOFFSET])
-						gb_plot_pixel(bitmap, xindex, yindex, state->m_sgb_pal[pal + spal[colour]]);
-					data >>= 1;
-				}
-				break;
-			case 0x20:				   /* priority is not set (overlaps bgnd & wnd, flip x) */
-				for (bit = 0; bit < 8; bit++, xindex++)
-				{
-					register int colour = ((data & 0x0100) ? 2 : 0) | ((data & 0x0001) ? 1 : 0);
-					if ((xindex >= SGB_XOFFSET && xindex < SGB_XOFFSET + 160) && colour)
-						gb_plot_pixel(bitmap, xindex, yindex, state->m_sgb_pal[pal + spal[colour]]);
-					data >>= 1;
-				}
-				break;
-			case 0x80:				   /* priority is set (behind bgnd & wnd, don't flip x) */
-				for (bit = 0; bit < 8; bit++, xindex++)
-				{
-					register int colour = ((data & 0x8000) ? 2 : 0) | ((data & 0x0080) ? 1 : 0);
-					if ((xindex >= SGB_XOFFSET && xindex < SGB_XOFFSET + 160) && colour && !state->m_lcd.bg_zbuf[xindex - SGB_XOFFSET])
-						gb_plot_pixel(bitmap, xindex, yindex, state->m_sgb_pal[pal + spal[colour]]);
-					data <<= 1;
-				}
-				break;
-			case 0x00:				   /* priority is not set (overlaps bgnd & wnd, don't flip x) */
-				for (bit = 0; bit < 8; bit++, xindex++)
-				{
-					register int colour = ((data & 0x8000) ? 2 : 0) | ((data & 0x0080) ? 1 : 0);
-					if ((xindex >= SGB_XOFFSET && xindex < SGB_XOFFSET + 160) && colour)
-						gb_plot_pixel(bitmap, xindex, yindex, state->m_sgb_pal[pal + spal[colour]]);
-					data <<= 1;
-				}
-				break;
-			}
+			/* priority is set (behind bgnd & wnd) */
+			if ((oam[3] & 0x80) && state->m_lcd.bg_zbuf[xindex + bit])
+				continue;
+			if (colour)
+				dest[xindex + bit] = state->m_sgb_pal[pal + spal[colour]];
 		}
-		oam -= 4;
 	}
 }
 
@@ -707,6 +735,14 @@ static void sgb_update_scanline( running_machine &machine )
 		{
 			state->m_lcd.end_x = MIN(160 - cycles_to_go,160);
 
+			/* As in gb_update_scanline, draw nothing in a skipped frame */
+			if ( machine.video().skip_drawing() )
+			{
+				state->m_lcd.start_x = state->m_lcd.end_x;
+				g_profiler.stop();
+				return;
+			}
+
 			/* if background or screen disabled clear line */
 			if ( ! ( LCDCONT & 0x01 ) )
 			{
@@ -718,9 +754,10 @@ static void sgb_update_scanline( running_machine &machine )
 			}
 			while( l < 2 )
 			{
-				UINT8	xindex, sgb_palette, *map, *tiles;
-				UINT16	data;
-				int	i, tile_index;
+				UINT8	xindex, sgb_palette, *map;
+				UINT16	*dest = BITMAP_ADDR16( bitmap, state->m_lcd.current_line + SGB_YOFFSET, SGB_XOFFSET );
+				const UINT8	*pix;
+				int	i, tile_base;
 
 				if ( ! state->m_lcd.layer[l].enabled )
 				{
@@ -728,7 +765,7 @@ static void sgb_update_scanline( running_machine &machine )
 					continue;
 				}
 				map = state->m_lcd.layer[l].bg_map + ( ( state->m_lcd.layer[l].bgline << 2 ) & 0x3E0 );
-				tiles = state->m_lcd.layer[l].bg_tiles + ( ( state->m_lcd.layer[l].bgline & 7 ) << 1 );
+				tile_base = gb_tile_base( &state->m_lcd, state->m_lcd.layer[l].bg_tiles );
 				xindex = state->m_lcd.start_x;
 				if ( xindex < state->m_lcd.layer[l].xstart )
 					xindex = state->m_lcd.layer[l].xstart;
@@ -737,24 +774,27 @@ static void sgb_update_scanline( running_machine &machine )
 					i = state->m_lcd.layer[l].xend;
 				i = i - xindex;
 
-				tile_index = (map[state->m_lcd.layer[l].xindex] ^ state->m_lcd.gb_tile_no_mod) * 16;
-				data = tiles[tile_index] | ( tiles[tile_index + 1] << 8 );
-				data <<= state->m_lcd.layer[l].xshift;
+				pix = gb_tile_row( &state->m_lcd, tile_base + ( map[ state->m_lcd.layer[l].xindex ] ^ state->m_lcd.gb_tile_no_mod ), state->m_lcd.layer[l].bgline & 7 );
 
 				/* Figure out which palette we're using */
 				sgb_palette = state->m_sgb_pal_map[ ( state->m_lcd.end_x - i ) >> 3 ][ state->m_lcd.current_line >> 3 ] << 2;
 
 				while( i > 0 )
 				{
-					while( ( state->m_lcd.layer[l].xshift < 8 ) && i )
+					/* Draw what is left of the current tile row as one run */
+					int	n = 8 - state->m_lcd.layer[l].xshift;
+					const UINT8	*run = pix + state->m_lcd.layer[l].xshift;
+
+					if ( n > i )
+						n = i;
+					state->m_lcd.layer[l].xshift += n;
+					i -= n;
+					while ( n-- > 0 )
 					{
-						register int colour = ( ( data & 0x8000 ) ? 2 : 0 ) | ( ( data & 0x0080 ) ? 1 : 0 );
-						gb_plot_pixel( bitmap, xindex + SGB_XOFFSET, state->m_lcd.current_line + SGB_YOFFSET, state->m_sgb_pal[ sgb_palette + state->m_lcd.gb_bpal[colour]] );
+						register int colour = *run++;
+						dest[ xindex ] = state->m_sgb_pal[ sgb_palette + state->m_lcd.gb_bpal[colour] ];
 						state->m_lcd.bg_zbuf[xindex] = colour;
 						xindex++;
-						data <<= 1;
-						state->m_lcd.layer[l].xshift++;
-						i--;
 					}
 					if ( state->m_lcd.layer[l].xshift == 8 )
 					{
@@ -763,13 +803,11 @@ static void sgb_update_scanline( running_machine &machine )
 						{
 							state->m_lcd.layer[0].bgline = ( SCROLLY + state->m_lcd.current_line ) & 0xFF;
 							map = state->m_lcd.layer[l].bg_map + ( ( state->m_lcd.layer[l].bgline << 2 ) & 0x3E0 );
-							tiles = state->m_lcd.layer[l].bg_tiles + ( ( state->m_lcd.layer[l].bgline & 7 ) << 1 );
 						}
 
 						state->m_lcd.layer[l].xindex = ( state->m_lcd.layer[l].xindex + 1 ) & 31;
 						state->m_lcd.layer[l].xshift = 0;
-						tile_index = ( map[ state->m_lcd.layer[l].xindex ] ^ state->m_lcd.gb_tile_no_mod ) * 16;
-						data = tiles[ tile_index ] | ( tiles[ tile_index + 1 ] << 8 );
+						pix = gb_tile_row( &state->m_lcd, tile_base + ( map[ state->m_lcd.layer[l].xindex ] ^ state->m_lcd.gb_tile_no_mod ), state->m_lcd.layer[l].bgline & 7 );
 						sgb_palette = state->m_sgb_pal_map[ ( state->m_lcd.end_x - i ) >> 3 ][ state->m_lcd.current_line >> 3 ] << 2;
 					}
 				}
@@ -812,8 +850,10 @@ INLINE void cgb_update_sprites ( running_machine &machine )
 {
 	gb_state *state = machine.driver_data<gb_state>();
 	bitmap_t *bitmap = machine.generic.tmpbitmap;
+	UINT16 *dest = BITMAP_ADDR16(bitmap, state->m_lcd.current_line, 0);
 	UINT8 height, tilemask, line, *oam;
-	int i, xindex, yindex;
+	UINT64 sprites;
+	int i;
 
 	if (LCDCONT & 0x04)
 	{
@@ -826,101 +866,86 @@ INLINE void cgb_update_sprites ( running_machine &machine )
 		tilemask = 0xFF;
 	}
 
-	yindex = state->m_lcd.current_line;
 	line = state->m_lcd.current_line + 16;
+	sprites = gb_sprites_on_line(&state->m_lcd, line, height);
 
-	oam = state->m_lcd.gb_oam->base() + 39 * 4;
-	for (i = 39; i >= 0; i--)
+	for (i = 39; sprites; i--)
 	{
-		/* if sprite is on current line && x-coordinate && x-coordinate is < 168 */
-		if (line >= oam[0] && line < (oam[0] + height) && oam[1] && oam[1] < 168)
+		const UINT8 *pix;
+		UINT8 pal;
+		int xindex, bit, bit_end, step;
+
+		if (!(sprites & ((UINT64)1 << i)))
+			continue;
+		sprites &= ~((UINT64)1 << i);
+
+		oam = state->m_lcd.gb_oam->base() + i * 4;
+
+		/* Handle mono mode for GB games */
+		if( ! state->m_lcd.gbc_mode )
+			pal = (oam[3] & 0x10) ? 4 : 0;
+		else
+			pal = ((oam[3] & 0x7) * 4);
+
+		pix = gb_sprite_row(&state->m_lcd, oam, (oam[3] & 0x8) >> 3, line, height, tilemask);
+		step = 1;
+		if (oam[3] & 0x20)			/* flip x ? */
 		{
-			UINT16 data;
-			UINT8 bit, pal;
+			pix += 7;
+			step = -1;
+		}
 
-			/* Handle mono mode for GB games */
-			if( ! state->m_lcd.gbc_mode )
-				pal = (oam[3] & 0x10) ? 4 : 0;
-			else
-				pal = ((oam[3] & 0x7) * 4);
+		/* only the part of the sprite inside the screen is drawn */
+		xindex = oam[1] - 8;
+		bit = (xindex < 0) ? -xindex : 0;
+		bit_end = MIN(8, 160 - xindex);
+
+		for (; bit < bit_end; bit++)
+		{
+			UINT8 zbuf = state->m_lcd.bg_zbuf[xindex + bit];
+			int colour = pix[bit * step];
 
-			xindex = oam[1] - 8;
-			if (oam[3] & 0x40)		   /* flip y ? */
+			if (oam[3] & 0x80)
 			{
-				data = *((UINT16 *) &state->m_lcd.gb_vram->base()[ ((oam[3] & 0x8)<<10) + (oam[2] & tilemask) * 16 + (height - 1 - line + oam[0]) * 2]);
+				/* priority is set (behind bgnd & wnd) */
+				if (zbuf)
+					continue;
 			}
-			else
+			else if ((zbuf & 0x80) && (zbuf & 0x7f) && (LCDCONT & 0x1))
 			{
-				data = *((UINT16 *) &state->m_lcd.gb_vram->base()[ ((oam[3] & 0x8)<<10) + (oam[2] & tilemask) * 16 + (line - oam[0]) * 2]);
+				/* the background tile has priority over all sprites */
+				colour = 0;
 			}
-#ifndef LSB_FIRST
-			data = (data << 8) | (data >> 8);
-#endif
-
-			switch (oam[3] & 0xA0)
+			if (colour)
 			{
-			case 0xA0:				   /* priority is set (behind bgnd & wnd, flip x) */
-				for (bit = 0; bit < 8; bit++, xindex++)
-				{
-					register int colour = ((data & 0x0100) ? 2 : 0) | ((data & 0x0001) ? 1 : 0);
-					if (colour && !state->m_lcd.bg_zbuf[xindex] && xindex >= 0 && xindex < 160)
-					{
-						if ( ! state->m_lcd.gbc_mode )
-							colour = pal ? state->m_lcd.gb_spal1[colour] : state->m_lcd.gb_spal0[colour];
-						gb_plot_pixel(bitmap, xindex, yindex, state->m_lcd.cgb_spal[pal + colour]);
-					}
-					data >>= 1;
-				}
-				break;
-			case 0x20:				   /* priority is not set (overlaps bgnd & wnd, flip x) */
-				for (bit = 0; bit < 8; bit++, xindex++)
-				{
-					register int colour = ((data & 0x0100) ? 2 : 0) | ((data & 0x0001) ? 1 : 0);
-					if((state->m_lcd.bg_zbuf[xindex] & 0x80) && (state->m_lcd.bg_zbuf[xindex] & 0x7f) && (LCDCONT & 0x1))
-						colour = 0;
-					if (colour && xindex >= 0 && xindex < 160)
-					{
-						if ( ! state->m_lcd.gbc_mode )
-							colour = pal ? state->m_lcd.gb_spal1[colour] : state->m_lcd.gb_spal0[colour];
-						gb_plot_pixel(bitmap, xindex, yindex, state->m_lcd.cgb_spal[pal + colour]);
-					}
-					data >>= 1;
-				}
-				break;
-			case 0x80:				   /* priority is set (behind bgnd & wnd, don't flip x) */
-				for (bit = 0; bit < 8; bit++, xindex++)
-				{
-					register int colour = ((data & 0x8000) ? 2 : 0) | ((data & 0x0080) ? 1 : 0);
-					if (colour && !state->m_lcd.bg_zbuf[xindex] && xindex >= 0 && xindex < 160)
-					{
-						if ( ! state->m_lcd.gbc_mode )
-							colour = pal ? state->m_lcd.gb_spal1[colour] : state->m_lcd.gb_spal0[colour];
-						gb_plot_pixel(bitmap, xindex, yindex, state->m_lcd.cgb_spal[pal + colour]);
-					}
-					data <<= 1;
-				}
-				break;
-			case 0x00:				   /* priority is not set (overlaps bgnd & wnd, don't flip x) */
-				for (bit = 0; bit < 8; bit++, xindex++)
-				{
-					register int colour = ((data & 0x8000) ? 2 : 0) | ((data & 0x0080) ? 1 : 0);
-					if((state->m_lcd.bg_zbuf[xindex] & 0x80) && (state->m_lcd.bg_zbuf[xindex] & 0x7f) && (LCDCONT & 0x1))
-						colour = 0;
-					if (colour && xindex >= 0 && xindex < 160)
-					{
-						if ( ! state->m_lcd.gbc_mode )
-							colour = pal ? state->m_lcd.gb_spal1[colour] : state->m_lcd.gb_spal0[colour];
-						gb_plot_pixel(bitmap, xindex, yindex, state->m_lcd.cgb_spal[pal + colour]);
-					}
-					data <<= 1;
-				}
-				break;
+				if ( ! state->m_lcd.gbc_mode )
+					colour = pal ? state->m_lcd.gb_spal1[colour] : state->m_lcd.gb_spal0[colour];
+				dest[xindex + bit] = state->m_lcd.cgb_spal[pal + colour];
 			}
 		}
-		oam -= 4;
 	}
 }
 
+/*
+  Decoded pixels of the background or window tile row at the current x index
+  of layer l, starting at the last pixel when the tile is flipped horizontally.
+ */
+INLINE const UINT8 *cgb_bg_tile_row( gb_state *state, int l, const UINT8 *map, const UINT8 *gbcmap, const int *tile_base )
+{
+	UINT8 attr = gbcmap[ state->m_lcd.layer[l].xindex ];
+	int row = state->m_lcd.layer[l].bgline & 0x07;
+	const UINT8 *pix;
+
+	/* Check for vertical flip */
+	if ( attr & 0x40 )
+		row = 7 - row;
+
+	pix = gb_tile_row( &state->m_lcd, tile_base[ ( attr & 0x08 ) >> 3 ] + ( map[ state->m_lcd.layer[l].xindex ] ^ state->m_lcd.gb_tile_no_mod ), row );
+
+	/* Check for horizontal flip */
+	return ( attr & 0x20 ) ? pix + 7 : pix;
+}
+
 static void cgb_update_scanline ( running_machine &machine )
 {
 	gb_state *state = machine.driver_data<gb_state>();
@@ -979,6 +1004,15 @@ static void cgb_update_scanline ( running_machine &machine )
 		if ( cycles_to_go < 160 )
 		{
 			state->m_lcd.end_x = MIN(160 - cycles_to_go,160);
+
+			/* As in gb_update_scanline, draw nothing in a skipped frame */
+			if ( machine.video().skip_drawing() )
+			{
+				state->m_lcd.start_x = state->m_lcd.end_x;
+				g_profiler.stop();
+				return;
+			}
+
 			/* Draw empty line when the background is disabled */
 			if ( ! ( LCDCONT & 0x01 ) )
 			{
@@ -990,9 +1024,10 @@ static void cgb_update_scanline ( running_machine &machine )
 			}
 			while ( l < 2 )
 			{
-				UINT8	xindex, *map, *tiles, *gbcmap;
-				UINT16	data;
-				int	i, tile_index;
+				UINT8	xindex, *map, *gbcmap;
+				UINT16	*dest = BITMAP_ADDR16( bitmap, state->m_lcd.current_line, 0 );
+				const UINT8	*pix;
+				int	i, tile_base[2];
 
 				if ( ! state->m_lcd.layer[l].enabled )
 				{
@@ -1001,17 +1036,8 @@ static void cgb_update_scanline ( running_machine &machine )
 				}
 				map = state->m_lcd.layer[l].bg_map + ( ( state->m_lcd.layer[l].bgline << 2 ) & 0x3E0 );
 				gbcmap = state->m_lcd.layer[l].gbc_map + ( ( state->m_lcd.layer[l].bgline << 2 ) & 0x3E0 );
-				tiles = ( gbcmap[ state->m_lcd.layer[l].xindex ] & 0x08 ) ? state->m_lcd.gbc_chrgen : state->m_lcd.gb_chrgen;
-
-				/* Check for vertical flip */
-				if ( gbcmap[ state->m_lcd.layer[l].xindex ] & 0x40 )
-				{
-					tiles += ( ( 7 - ( state->m_lcd.layer[l].bgline & 0x07 ) ) << 1 );
-				}
-				else
-				{
-					tiles += ( ( state->m_lcd.layer[l].bgline & 0x07 ) << 1 );
-				}
+				tile_base[0] = gb_tile_base( &state->m_lcd, state->m_lcd.gb_chrgen );
+				tile_base[1] = gb_tile_base( &state->m_lcd, state->m_lcd.gbc_chrgen );
 				xindex = state->m_lcd.start_x;
 				if ( xindex < state->m_lcd.layer[l].xstart )
 					xindex = state->m_lcd.layer[l].xstart;
@@ -1020,39 +1046,28 @@ static void cgb_update_scanline ( running_machine &machine )
 					i = state->m_lcd.layer[l].xend;
 				i = i - xindex;
 
-				tile_index = ( map[ state->m_lcd.layer[l].xindex ] ^ state->m_lcd.gb_tile_no_mod ) * 16;
-				data = tiles[ tile_index ] | ( tiles[ tile_index + 1 ] << 8 );
-				/* Check for horinzontal flip */
-				if ( gbcmap[ state->m_lcd.layer[l].xindex ] & 0x20 )
-				{
-					data >>= state->m_lcd.layer[l].xshift;
-				}
-				else
-				{
-					data <<= state->m_lcd.layer[l].xshift;
-				}
+				pix = cgb_bg_tile_row( state, l, map, gbcmap, tile_base );
 
 				while ( i > 0 )
 				{
-					while ( ( state->m_lcd.layer[l].xshift < 8 ) && i )
+					/* Draw what is left of the current tile row as one run */
+					UINT8	attr = gbcmap[ state->m_lcd.layer[l].xindex ];
+					int	n = 8 - state->m_lcd.layer[l].xshift;
+					int	step = ( attr & 0x20 ) ? -1 : 1;		/* horizontal flip */
+					const UINT8	*run = pix + state->m_lcd.layer[l].xshift * step;
+					const UINT16	*bpal = ( ! state->m_lcd.gbc_mode ) ? NULL : &state->m_lcd.cgb_bpal[ ( attr & 0x07 ) * 4 ];
+
+					if ( n > i )
+						n = i;
+					state->m_lcd.layer[l].xshift += n;
+					i -= n;
+					while ( n-- > 0 )
 					{
-						int colour;
-						/* Check for horinzontal flip */
-						if ( gbcmap[ state->m_lcd.layer[l].xindex ] & 0x20 )
-						{
-							colour = ( ( data & 0x0100 ) ? 2 : 0 ) | ( ( data & 0x0001 ) ? 1 : 0 );
-							data >>= 1;
-						}
-						else
-						{
-							colour = ( ( data & 0x8000 ) ? 2 : 0 ) | ( ( data & 0x0080 ) ? 1 : 0 );
-							data <<= 1;
-						}
-						gb_plot_pixel( bitmap, xindex, state->m_lcd.current_line, state->m_lcd.cgb_bpal[ ( ! state->m_lcd.gbc_mode ) ? state->m_lcd.gb_bpal[colour] : ( ( ( gbcmap[ state->m_lcd.layer[l].xindex ] & 0x07 ) * 4 ) + colour ) ] );
-						state->m_lcd.bg_zbuf[ xindex ] = colour + ( gbcmap[ state->m_lcd.layer[l].xindex ] & 0x80 );
+						register int colour = *run;
+						run += step;
+						dest[ xindex ] = bpal ? bpal[ colour ] : state->m_lcd.cgb_bpal[ state->m_lcd.gb_bpal[colour] ];
+						state->m_lcd.bg_zbuf[ xindex ] = colour + ( attr & 0x80 );
 						xindex++;
-						state->m_lcd.layer[l].xshift++;
-						i--;
 					}
 					if ( state->m_lcd.layer[l].xshift == 8 )
 					{
@@ -1066,19 +1081,7 @@ static void cgb_update_scanline ( running_machine &machine )
 
 						state->m_lcd.layer[l].xindex = ( state->m_lcd.layer[l].xindex + 1 ) & 31;
 						state->m_lcd.layer[l].xshift = 0;
-						tiles = ( gbcmap[ state->m_lcd.layer[l].xindex ] & 0x08 ) ? state->m_lcd.gbc_chrgen : state->m_lcd.gb_chrgen;
-
-						/* Check for vertical flip */
-						if ( gbcmap[ state->m_lcd.layer[l].xindex ] & 0x40 )
-						{
-							tiles += ( ( 7 - ( state->m_lcd.layer[l].bgline & 0x07 ) ) << 1 );
-						}
-						else
-						{
-							tiles += ( ( state->m_lcd.layer[l].bgline & 0x07 ) << 1 );
-						}
-						tile_index = ( map[ state->m_lcd.layer[l].xindex ] ^ state->m_lcd.gb_tile_no_mod ) * 16;
-						data = tiles[ tile_index ] | ( tiles[ tile_index + 1 ] << 8 );
+						pix = cgb_bg_tile_row( state, l, map, gbcmap, tile_base );
 					}
 				}
 				l++;
@@ -1260,6 +1263,7 @@ void gb_video_reset( running_machine &machine, int mode )
 	state->m_lcd.gb_vram = machine.region_alloc("gfx1", vram_size, 1, ENDIANNESS_LITTLE );
 	state->m_lcd.gb_oam = machine.region_alloc("gfx2", 0x100, 1, ENDIANNESS_LITTLE );
 	memset( state->m_lcd.gb_vram->base(), 0, vram_size );
+	memset( state->m_lcd.tile_dirty, 1, sizeof( state->m_lcd.tile_dirty ) );
 
 	state->m_lcd.gb_vram_ptr = state->m_lcd.gb_vram->base();
 	state->m_lcd.gb_chrgen = state->m_lcd.gb_vram->base();
@@ -2007,11 +2011,15 @@ READ8_HANDLER( gb_vram_r )
 WRITE8_HANDLER( gb_vram_w )
 {
 	gb_state *state = space->machine().driver_data<gb_state>();
-	if ( state->m_lcd.vram_locked == LOCKED )
+	if ( state->m_lcd.vram_locked == LOCKED || state->m_lcd.gb_vram_ptr[offset] == data )
 	{
 		return;
 	}
 	state->m_lcd.gb_vram_ptr[offset] = data;
+
+	/* Tile data has to be decoded again before it is drawn */
+	if ( offset < 0x1800 )
+		state->m_lcd.tile_dirty[ gb_tile_base( &state->m_lcd, state->m_lcd.gb_vram_ptr + offset ) ] = 1;
 }
 
 READ8_HANDLER( gb_oam_r )
@@ -2023,11 +2031,22 @@ READ8_HANDLER( gb_oam_r )
 WRITE8_HANDLER( gb_oam_w )
 {
 	gb_state *state = space->machine().driver_data<gb_state>();
+	UINT8 *oam = state->m_lcd.gb_oam->base();
+
 	if ( state->m_lcd.oam_locked == LOCKED || offset >= 0xa0 )
 	{
 		return;
 	}
-	state->m_lcd.gb_oam->base()[offset] = data;
+
+	/* Move the sprite in the per line table when its position changes */
+	if ( ! ( offset & 0x02 ) && state->m_lcd.sprite_height && oam[offset] != data )
+	{
+		gb_sprite_lines_update( &state->m_lcd, offset >> 2, 0 );
+		oam[offset] = data;
+		gb_sprite_lines_update( &state->m_lcd, offset >> 2, 1 );
+		return;
+	}
+	oam[offset] = data;
 }
 
 WRITE8_HANDLER ( gb_video_w )
@@ -2128,6 +2147,8 @@ WRITE8_HANDLER ( gb_video_w )
 			offset = (UINT16) data << 8;
 			for (data = 0; data < 0xA0; data++)
 				*P++ = space->read_byte(offset++);
+			/* rebuild the per line sprite table on its next use */
+			state->m_lcd.sprite_height = 0;
 		}
 		return;
 	case 0x07:						/* BGP - Background Palette */
@@ -83,6 +83,8 @@ struct _vic2_state
 	device_t *cpu;
 
 	UINT8 rdy_cycles;
+	emu_timer *raster_timer;		// runs pal/ntsc_timer_callback once per cycle
+	emu_timer *lightpen_timer;
 	UINT8 reg[0x80];
 
 	int on;								/* rastering of the screen */
@@ -109,6 +111,7 @@ struct _vic2_state
 
 	/* GFX */
 	UINT8 draw_this_line;
+	UINT8 skip_drawing;							// frame won't be shown, only track collisions (not saved, set each line)
 	UINT8 is_bad_line;
 	UINT8 bad_lines_enabled;
 	UINT8 display_state;
@@ -335,6 +338,20 @@ static TIMER_CALLBACK( vic2_timer_timeout )
 }
 
 
+// Run pal/ntsc_timer_callback again after the given time (the callbacks
+// define an adjust() macro, so the timers are set from out here)
+INLINE void vic2_set_raster_timer( vic2_state *vic2, attotime duration )
+{
+	vic2->raster_timer->adjust(duration);
+}
+
+// Latch the light pen position as soon as possible
+INLINE void vic2_trigger_lightpen( vic2_state *vic2 )
+{
+	vic2->lightpen_timer->adjust(attotime::zero, 1);
+}
+
+
 // modified VIC II emulation by Christian Bauer starts here...
 
 // Idle access
@@ -491,7 +508,7 @@ INLINE void vic2_graphics_access( running_machine &machine, vic2_state *vic2 )
 
 INLINE void vic2_draw_background( vic2_state *vic2 )
 {
-	if (vic2->draw_this_line)
+	if (vic2->draw_this_line && !vic2->skip_drawing)
 	{
 		UINT8 c;
 
@@ -579,6 +596,21 @@ INLINE void vic2_draw_multi( vic2_state *vic2, UINT16 p, UINT8 c0, UINT8 c1, UIN
 	vic2->fore_coll_buf[p + 0] = data & 2;
 }
 
+// Only the foreground collision buffer of vic2_draw_mono/vic2_draw_multi,
+// for lines in a frame that won't be shown
+INLINE void vic2_draw_collision( vic2_state *vic2, UINT16 p, int multi )
+{
+	UINT8 data = vic2->gfx_data;
+	int i;
+
+	if (multi)
+		for (i = 7; i >= 0; i -= 2, data >>= 2)
+			vic2->fore_coll_buf[p + i] = vic2->fore_coll_buf[p + i - 1] = data & 2;
+	else
+		for (i = 7; i >= 0; i--, data >>= 1)
+			vic2->fore_coll_buf[p + i] = data & 1;
+}
+
 // Graphics display (8 pixels)
 static void vic2_draw_graphics( vic2_state *vic2 )
 {
@@ -607,6 +639,27 @@ static void vic2_draw_graphics( vic2_state *vic2 )
 		vic2->fore_coll_buf[p + 0] = 0;
 		vic2_draw_background(vic2);
 	}
+	else if (vic2->skip_drawing)
+	{
+		UINT16 p = vic2->graphic_x + HORIZONTALPOS;
+		switch (GFXMODE)
+		{
+			case 0:
+			case 2:
+			case 4:
+				vic2_draw_collision(vic2, p, 0);
+				break;
+			case 1:
+				vic2_draw_collision(vic2, p, vic2->color_data & 0x08);
+				break;
+			case 3:
+				vic2_draw_collision(vic2, p, 1);
+				break;
+			default:
+				memset(&vic2->fore_coll_buf[p], 0, 8);
+				break;
+		}
+	}
 	else
 	{
 		UINT8 tmp_col;
@@ -1046,7 +1099,7 @@ if (machine.input().code_pressed_once(KEYCODE_Z)) printf("b:%02x 1:%02x 2:%02x 3
 //          if (LIGHTPEN_BUTTON)
 			{
 				/* lightpen timer start */
-				machine.scheduler().timer_set(attotime(0, 0), FUNC(vic2_timer_timeout), 1, vic2);
+				vic2_trigger_lightpen(vic2);
 			}
 		}
 		else
@@ -1061,6 +1114,7 @@ if (machine.input().code_pressed_once(KEYCODE_Z)) printf("b:%02x 1:%02x 2:%02x 3
 
 			vic2->draw_this_line =	((VIC2_RASTER_2_EMU(vic2->rasterline) >= VIC2_RASTER_2_EMU(VIC2_FIRST_DISP_LINE)) &&
 						(VIC2_RASTER_2_EMU(vic2->rasterline ) <= VIC2_RASTER_2_EMU(VIC2_LAST_DISP_LINE)));
+			vic2->skip_drawing = machine.video().skip_drawing();
 		}
 
 		vic2->border_on_sample[0] = vic2->border_on;
@@ -1526,10 +1580,12 @@ if (machine.input().code_pressed_once(KEYCODE_Z)) printf("b:%02x 1:%02x 2:%02x 3
 		vic2_draw_background(vic2);
 		vic2_sample_border(vic2);
 
+		// the sprites still run in a skipped frame for their collisions
 		if (vic2->draw_this_line)
-		{
 			vic2_draw_sprites(machine, vic2);
 
+		if (vic2->draw_this_line && !vic2->skip_drawing)
+		{
 			if (vic2->border_on_sample[0])
 				for (i = 0; i < 4; i++)
 					plot_box(vic2->bitmap, VIC2_X_2_EMU(i * 8), VIC2_RASTER_2_EMU(vic2->rasterline), 8, 1, vic2->border_color_sample[i]);
@@ -1615,7 +1671,7 @@ if (machine.input().code_pressed_once(KEYCODE_Z)) printf("b:%02x 1:%02x 2:%02x 3
 	}
 
 	vic2->raster_x += 8;
-	machine.scheduler().timer_set(machine.device<cpu_device>("maincpu")->cycles_to_attotime(1), FUNC(pal_timer_callback), 0, vic2);
+	vic2_set_raster_timer(vic2, machine.device<cpu_device>("maincpu")->cycles_to_attotime(1));
 }
 
 static TIMER_CALLBACK( ntsc_timer_callback )
@@ -1637,7 +1693,7 @@ static TIMER_CALLBACK( ntsc_timer_callback )
 //          if (LIGHTPEN_BUTTON)
 			{
 				/* lightpen timer starten */
-				machine.scheduler().timer_set(attotime(0, 0), FUNC(vic2_timer_timeout), 1, vic2);
+				vic2_trigger_lightpen(vic2);
 			}
 		}
 		else
@@ -1652,6 +1708,7 @@ static TIMER_CALLBACK( ntsc_timer_callback )
 
 			vic2->draw_this_line = ((VIC2_RASTER_2_EMU(vic2->rasterline) >= VIC2_RASTER_2_EMU(VIC2_FIRST_DISP_LINE)) &&
 						(VIC2_RASTER_2_EMU(vic2->rasterline ) <= VIC2_RASTER_2_EMU(VIC2_LAST_DISP_LINE)));
+			vic2->skip_drawing = machine.video().skip_drawing();
 		}
 
 		vic2->border_on_sample[0] = vic2->border_on;
@@ -2115,10 +2172,12 @@ static TIMER_CALLBACK( ntsc_timer_callback )
 		vic2_draw_background(vic2);
 		vic2_sample_border(vic2);
 
+		// the sprites still run in a skipped frame for their collisions
 		if (vic2->draw_this_line)
-		{
 			vic2_draw_sprites(machine, vic2);
 
+		if (vic2->draw_this_line && !vic2->skip_drawing)
+		{
 			if (vic2->border_on_sample[0])
 				for (i = 0; i < 4; i++)
 					plot_box(vic2->bitmap, VIC2_X_2_EMU(i * 8), VIC2_RASTER_2_EMU(vic2->rasterline), 8, 1, vic2->border_color_sample[i]);
@@ -2194,7 +2253,7 @@ static TIMER_CALLBACK( ntsc_timer_callback )
 	}
 
 	vic2->raster_x += 8;
-	machine.scheduler().timer_set(machine.device<cpu_device>("maincpu")->cycles_to_attotime(1), FUNC(ntsc_timer_callback), 0, vic2);
+	vic2_set_raster_timer(vic2, machine.device<cpu_device>("maincpu")->cycles_to_attotime(1));
 }
 
 
@@ -2621,11 +2680,14 @@ static DEVICE_START( vic2 )
 	vic2->lightpen_x_cb = intf->x_cb;
 	vic2->lightpen_y_cb = intf->y_cb;
 
-	// immediately call the timer to handle the first line
+	// immediately call the timer to handle the first line; these are
+	// allocated rather than one-shot so that they are saved with the state
 	if (vic2->type == VIC6569 || vic2->type == VIC8566)
-		device->machine().scheduler().timer_set(downcast<cpu_device *>(vic2->cpu)->cycles_to_attotime(0), FUNC(pal_timer_callback), 0, vic2);
+		vic2->raster_timer = device->machine().scheduler().timer_alloc(FUNC(pal_timer_callback), vic2);
 	else
-		device->machine().scheduler().timer_set(downcast<cpu_device *>(vic2->cpu)->cycles_to_attotime(0), FUNC(ntsc_timer_callback), 0, vic2);
+		vic2->raster_timer = device->machine().scheduler().timer_alloc(FUNC(ntsc_timer_callback), vic2);
+	vic2_set_raster_timer(vic2, downcast<cpu_device *>(vic2->cpu)->cycles_to_attotime(0));
+	vic2->lightpen_timer = device->machine().scheduler().timer_alloc(FUNC(vic2_timer_timeout), vic2);
 
 	for (i = 0; i < 256; i++)
 	{
@@ -2755,6 +2817,7 @@ static DEVICE_RESET( vic2 )
 	vic2->dy_stop = ROW24_YSTOP;
 
 	vic2->draw_this_line = 0;
+	vic2->skip_drawing = 0;
 	vic2->is_bad_line = 0;
 	vic2->bad_lines_enabled = 0;
 	vic2->display_state = 0;
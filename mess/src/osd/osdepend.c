@@ -178,6 +178,23 @@ void osd_interface::set_mastervolume(int attenuation)
 }
 
 
+//-------------------------------------------------
+//  get_audio_status - report on the queue of
+//  sound waiting to be played, returning false
+//  if there is none to report on
+//-------------------------------------------------
+
+bool osd_interface::get_audio_status(osd_audio_status &status)
+{
+	//
+	// OSDs that queue sound for a separately-clocked audio device can
+	// report how full that queue is here; the emulation uses it to keep
+	// its pace matched to the device's.
+	//
+	return false;
+}
+
+
 //-------------------------------------------------
 //  customize_input_type_list - provide OSD
 //  additions/modifications to the input list
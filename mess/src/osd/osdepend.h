@@ -58,6 +58,19 @@ class device_t;
 typedef void *osd_font;
 
 
+// ======================> osd_audio_status
+
+// state of the OSD's queue of sound waiting to be played
+struct osd_audio_status
+{
+	UINT32				buffered;			// sample frames queued and not yet played
+	UINT32				target;				// sample frames the OSD aims to keep queued
+	UINT32				consumed;			// running count of sample frames played (wraps)
+	UINT32				underruns;			// times the audio device found the queue empty
+	UINT32				overruns;			// times new sound found the queue full
+};
+
+
 // ======================> osd_interface
 
 // description of the currently-running machine
@@ -82,6 +95,7 @@ public:
 	// audio overridables
 	virtual void update_audio_stream(const INT16 *buffer, int samples_this_frame);
 	virtual void set_mastervolume(int attenuation);
+	virtual bool get_audio_status(osd_audio_status &status);
 
 	// input overridables
 	virtual void customize_input_type_list(simple_list<input_type_entry> &typelist);
@@ -129,6 +129,17 @@ void mini_osd_interface::init(running_machine &machine)
 	// call our parent
 	osd_interface::init(machine);
 
+	// determine if we are benchmarking, and adjust options appropriately
+	int bench = machine.options().bench();
+	astring error_string;
+	if (bench > 0)
+	{
+		machine.options().set_value(OPTION_THROTTLE, false, OPTION_PRIORITY_MAXIMUM, error_string);
+		machine.options().set_value(OPTION_SOUND, false, OPTION_PRIORITY_MAXIMUM, error_string);
+		machine.options().set_value(OPTION_SECONDS_TO_RUN, bench, OPTION_PRIORITY_MAXIMUM, error_string);
+		assert(!error_string);
+	}
+
 	// initialize the video system by allocating a rendering target
 	our_target = machine.render().target_alloc();
 
@@ -180,8 +191,8 @@ void mini_osd_interface::update(bool skip_redraw)
 	// do the drawing here
 	primlist.release_lock();
 
-	// after 5 seconds, exit
-	if (machine().time() > attotime::from_seconds(5))
+	// after 5 seconds, exit, unless we were told how long to run
+	if (machine().options().seconds_to_run() == 0 && machine().time() > attotime::from_seconds(5))
 		machine().schedule_exit();
 }
 
@@ -38,6 +38,14 @@
 //  CONSTANTS
 //============================================================
 
+// what drawsdl_find_changes found we need to redraw
+enum
+{
+	REDRAW_NOTHING,
+	REDRAW_CHANGES,
+	REDRAW_EVERYTHING
+};
+
 //============================================================
 //  TYPES
 //============================================================
@@ -51,6 +59,23 @@ typedef struct _sdl_scale_mode sdl_scale_mode;
 #define	SDL_SCALEMODE_BEST	(0)
 #endif
 
+/* sdl_prim_info is what we remember about a primitive we drew */
+typedef struct _sdl_prim_info sdl_prim_info;
+struct _sdl_prim_info
+{
+	// everything here must match for the primitive to be unchanged;
+	// zeroed first so that memcmp sees no stray padding
+	render_primitive::primitive_type type;
+	UINT32				flags;
+	render_bounds		bounds;
+	render_color		color;
+	float				width;
+	render_quad_texuv	texcoords;
+	UINT32				texwidth;
+	UINT32				texheight;
+	UINT32				contentid;
+};
+
 /* sdl_info is the information about SDL for the current screen */
 typedef struct _sdl_info sdl_info;
 struct _sdl_info
@@ -80,6 +105,11 @@ struct _sdl_info
 	int					old_blitwidth;
 	int					old_blitheight;
 
+	// the primitives drawn last frame, so we only redraw what changed
+	sdl_prim_info		*last_prims;
+	int					last_prim_count;
+	int					last_prim_alloc;
+
 	// shortcut to scale mode info
 
 	const sdl_scale_mode		*scale_mode;
@@ -127,11 +157,11 @@ static void setup_texture(sdl_window_info *window, int tempwidth, int tempheight
 #endif
 
 // soft rendering
-static void drawsdl_rgb888_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch);
-static void drawsdl_bgr888_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch);
-static void drawsdl_bgra888_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch);
-static void drawsdl_rgb565_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch);
-static void drawsdl_rgb555_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch);
+static void drawsdl_rgb888_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, const rectangle *clip);
+static void drawsdl_bgr888_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, const rectangle *clip);
+static void drawsdl_bgra888_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, const rectangle *clip);
+static void drawsdl_rgb565_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, const rectangle *clip);
+static void drawsdl_rgb555_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, const rectangle *clip);
 
 // YUV overlays
 
@@ -498,6 +528,9 @@ static int drawsdl_window_create(sdl_window_info *window, int width, int height)
 	if (sdl->scale_mode->is_yuv)
 		yuv_overlay_init(window);
 
+	// drawsdl_find_changes redraws only what the screens mark dirty
+	window->machine().render().set_dirty_tracking(!sdl->scale_mode->is_yuv);
+
 	// set the window title
 	SDL_WM_SetCaption(window->title, "SDLMAME");
 #endif
@@ -535,6 +568,9 @@ static void drawsdl_window_resize(sdl_window_info *window, int width, int height
 	window->width = sdl->sdlsurf->w;
 	window->height = sdl->sdlsurf->h;
 
+	// nothing on the new surface yet
+	sdl->last_prim_count = 0;
+
 	if (sdl->scale_mode->is_yuv)
 	{
 		yuv_overlay_init(window);
@@ -586,6 +622,11 @@ static void drawsdl_window_destroy(sdl_window_info *window)
 		global_free(sdl->yuv_bitmap);
 		sdl->yuv_bitmap = NULL;
 	}
+	if (sdl->last_prims != NULL)
+	{
+		global_free(sdl->last_prims);
+		sdl->last_prims = NULL;
+	}
 	osd_free(sdl);
 	window->dxdata = NULL;
 }
@@ -650,6 +691,134 @@ static render_primitive_list &drawsdl_window_get_primitives(sdl_window_info *win
 	return window->target->get_primitives();
 }
 
+#if (!SDL_VERSION_ATLEAST(1,3,0))
+//============================================================
+//  drawsdl_add_dirty
+//============================================================
+
+static void drawsdl_add_dirty(rectangle &dirty, float x0, float y0, float x1, float y1, const render_bounds &bounds)
+{
+	// never outside the primitive itself
+	x0 = MAX(x0, floor(bounds.x0));
+	y0 = MAX(y0, floor(bounds.y0));
+	x1 = MIN(x1, ceil(bounds.x1));
+	y1 = MIN(y1, ceil(bounds.y1));
+	if (x0 >= x1 || y0 >= y1)
+		return;
+
+	dirty.min_x = MIN(dirty.min_x, (INT32)floor(x0));
+	dirty.min_y = MIN(dirty.min_y, (INT32)floor(y0));
+	dirty.max_x = MAX(dirty.max_x, (INT32)ceil(x1) - 1);
+	dirty.max_y = MAX(dirty.max_y, (INT32)ceil(y1) - 1);
+}
+
+//============================================================
+//  drawsdl_find_changes
+//  compares the primitive list against the one drawn last
+//  time; for REDRAW_CHANGES, dirty is set to the pixels
+//  that need redrawing
+//============================================================
+
+static int drawsdl_find_changes(sdl_info *sdl, const render_primitive_list &primlist, int width, int height, rectangle &dirty)
+{
+	const render_primitive *prim;
+	int everything = FALSE;
+	int lines = FALSE;
+	int count = 0;
+
+	dirty.min_x = width;
+	dirty.min_y = height;
+	dirty.max_x = dirty.max_y = -1;
+
+	for (prim = primlist.first(); prim != NULL; prim = prim->next(), count++)
+	{
+		sdl_prim_info info, *last;
+
+		// grow our copy of the list if needed
+		if (count == sdl->last_prim_alloc)
+		{
+			int newalloc = MAX(sdl->last_prim_alloc * 2, 16);
+			sdl_prim_info *newprims = global_alloc_array(sdl_prim_info, newalloc);
+			if (sdl->last_prims != NULL)
+			{
+				memcpy(newprims, sdl->last_prims, sdl->last_prim_alloc * sizeof(*newprims));
+				global_free(sdl->last_prims);
+			}
+			sdl->last_prims = newprims;
+			sdl->last_prim_alloc = newalloc;
+		}
+
+		memset(&info, 0, sizeof(info));
+		info.type = prim->type;
+		info.flags = prim->flags;
+		info.bounds = prim->bounds;
+		info.color = prim->color;
+		info.width = prim->width;
+		if (prim->texture.base != NULL)
+		{
+			info.texcoords = prim->texcoords;
+			info.texwidth = prim->texture.width;
+			info.texheight = prim->texture.height;
+			info.contentid = prim->texture.contentid;
+		}
+		if (prim->type == render_primitive::LINE)
+			lines = TRUE;
+
+		last = &sdl->last_prims[count];
+		if (count >= sdl->last_prim_count)
+			everything = TRUE;
+		else if (memcmp(&info, last, sizeof(info) - sizeof(info.contentid)) != 0)
+			everything = TRUE;
+		else if (info.contentid != last->contentid)
+		{
+			const render_texinfo &tex = prim->texture;
+			const render_quad_texuv &uv = prim->texcoords;
+
+			// if the texture only changed in part and isn't rotated or
+			// flipped, map the changed texels to the screen; one texel
+			// of slack either side covers bilinear filtering
+			if (tex.dirtyfrom != 0 && tex.dirtyfrom == last->contentid &&
+				uv.tl.u == uv.bl.u && uv.tr.u == uv.br.u && uv.tl.u < uv.tr.u &&
+				uv.tl.v == uv.tr.v && uv.bl.v == uv.br.v && uv.tl.v < uv.bl.v)
+			{
+				float xscale = (prim->bounds.x1 - prim->bounds.x0) / ((uv.tr.u - uv.tl.u) * tex.width);
+				float yscale = (prim->bounds.y1 - prim->bounds.y0) / ((uv.bl.v - uv.tl.v) * tex.height);
+				float xorigin = prim->bounds.x0 - uv.tl.u * tex.width * xscale;
+				float yorigin = prim->bounds.y0 - uv.tl.v * tex.height * yscale;
+
+				drawsdl_add_dirty(dirty,
+						xorigin + (tex.dirty.min_x - 1) * xscale - 1.0f,
+						yorigin + (tex.dirty.min_y - 1) * yscale - 1.0f,
+						xorigin + (tex.dirty.max_x + 2) * xscale + 1.0f,
+						yorigin + (tex.dirty.max_y + 2) * yscale + 1.0f,
+						prim->bounds);
+			}
+			else
+				drawsdl_add_dirty(dirty, prim->bounds.x0, prim->bounds.y0, prim->bounds.x1, prim->bounds.y1, prim->bounds);
+		}
+		*last = info;
+	}
+
+	if (count != sdl->last_prim_count)
+		everything = TRUE;
+	sdl->last_prim_count = count;
+
+	// lines aren't clipped, so any change means drawing them all again
+	if (everything || (lines && dirty.min_x <= dirty.max_x))
+		return REDRAW_EVERYTHING;
+	if (dirty.min_x > dirty.max_x)
+		return REDRAW_NOTHING;
+
+	dirty.min_x = MAX(dirty.min_x, 0);
+	dirty.min_y = MAX(dirty.min_y, 0);
+	dirty.max_x = MIN(dirty.max_x, width - 1);
+	dirty.max_y = MIN(dirty.max_y, height - 1);
+	if (dirty.min_x > dirty.max_x || dirty.min_y > dirty.max_y)
+		return REDRAW_NOTHING;
+	return REDRAW_CHANGES;
+}
+#endif
+
 //============================================================
 //  drawsdl_window_draw
 //============================================================
@@ -665,6 +834,11 @@ static int drawsdl_window_draw(sdl_window_info *window, UINT32 dc, int update)
 	Uint32 amask;
 #endif
 	INT32 vofs, hofs, blitwidth, blitheight, ch, cw;
+	const rectangle *clip = NULL;
+#if (!SDL_VERSION_ATLEAST(1,3,0))
+	int redraw = REDRAW_EVERYTHING;
+	rectangle dirty;
+#endif
 
 	if (video_config.novideo)
 	{
@@ -694,6 +868,28 @@ static int drawsdl_window_draw(sdl_window_info *window, UINT32 dc, int update)
 		sdl->blittimer = 3;
 	}
 
+	// find out what changed since the last frame; with nothing at all
+	// we can skip the lock, draw and flip
+	if (!sdl->scale_mode->is_yuv)
+	{
+		window->primlist->acquire_lock();
+		redraw = drawsdl_find_changes(sdl, *window->primlist, window->blitwidth, window->blitheight, dirty);
+		window->primlist->release_lock();
+
+		// the back half of a real double buffer is a frame behind, so
+		// it can't be patched up (the browser has just the one canvas)
+#ifndef SDLMAME_EMSCRIPTEN
+		if (redraw == REDRAW_CHANGES && (sdl->sdlsurf->flags & SDL_DOUBLEBUF))
+			redraw = REDRAW_EVERYTHING;
+#endif
+		if (sdl->blittimer > 0)
+			redraw = REDRAW_EVERYTHING;
+		if (redraw == REDRAW_NOTHING)
+			return 0;
+		if (redraw == REDRAW_CHANGES)
+			clip = &dirty;
+	}
+
 	if (SDL_MUSTLOCK(sdl->sdlsurf)) SDL_LockSurface(sdl->sdlsurf);
 	// Clear if necessary
 
@@ -810,23 +1006,23 @@ static int drawsdl_window_draw(sdl_window_info *window, UINT32 dc, int update)
 		switch (rmask)
 		{
 			case 0x0000ff00:
-				drawsdl_bgra888_draw_primitives(*window->primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				drawsdl_bgra888_draw_primitives(*window->primlist, surfptr, mamewidth, mameheight, pitch / 4, clip);
 				break;
 
 			case 0x00ff0000:
-				drawsdl_rgb888_draw_primitives(*window->primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				drawsdl_rgb888_draw_primitives(*window->primlist, surfptr, mamewidth, mameheight, pitch / 4, clip);
 				break;
 
 			case 0x000000ff:
-				drawsdl_bgr888_draw_primitives(*window->primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				drawsdl_bgr888_draw_primitives(*window->primlist, surfptr, mamewidth, mameheight, pitch / 4, clip);
 				break;
 
 			case 0xf800:
-				drawsdl_rgb565_draw_primitives(*window->primlist, surfptr, mamewidth, mameheight, pitch / 2);
+				drawsdl_rgb565_draw_primitives(*window->primlist, surfptr, mamewidth, mameheight, pitch / 2, clip);
 				break;
 
 			case 0x7c00:
-				drawsdl_rgb555_draw_primitives(*window->primlist, surfptr, mamewidth, mameheight, pitch / 2);
+				drawsdl_rgb555_draw_primitives(*window->primlist, surfptr, mamewidth, mameheight, pitch / 2, clip);
 				break;
 
 			default:
@@ -838,7 +1034,7 @@ static int drawsdl_window_draw(sdl_window_info *window, UINT32 dc, int update)
 	{
 		assert (sdl->yuv_bitmap != NULL);
 		assert (surfptr != NULL);
-		drawsdl_rgb555_draw_primitives(*window->primlist, sdl->yuv_bitmap, sdl->hw_scale_width, sdl->hw_scale_height, sdl->hw_scale_width);
+		drawsdl_rgb555_draw_primitives(*window->primlist, sdl->yuv_bitmap, sdl->hw_scale_width, sdl->hw_scale_height, sdl->hw_scale_width, NULL);
 		sdl->scale_mode->yuv_blit((UINT16 *)sdl->yuv_bitmap, sdl, surfptr, pitch);
 	}
 
@@ -847,7 +1043,12 @@ static int drawsdl_window_draw(sdl_window_info *window, UINT32 dc, int update)
 	// unlock and flip
 #if (!SDL_VERSION_ATLEAST(1,3,0))
 	if (SDL_MUSTLOCK(sdl->sdlsurf)) SDL_UnlockSurface(sdl->sdlsurf);
-	if (!sdl->scale_mode->is_yuv)
+	if (clip != NULL)
+	{
+		SDL_UpdateRect(sdl->sdlsurf, hofs + clip->min_x, vofs + clip->min_y,
+				clip->max_x + 1 - clip->min_x, clip->max_y + 1 - clip->min_y);
+	}
+	else if (!sdl->scale_mode->is_yuv)
 	{
 		SDL_Flip(sdl->sdlsurf);
 	}
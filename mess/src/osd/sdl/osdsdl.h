@@ -72,7 +72,6 @@
 #define SDLOPTION_SCALEMODE				"scalemode"
 
 #define SDLOPTION_MULTITHREADING		"multithreading"
-#define SDLOPTION_BENCH					"bench"
 #define SDLOPTION_NUMPROCESSORS			"numprocessors"
 
 #define SDLOPTION_WAITVSYNC				"waitvsync"
@@ -159,7 +158,6 @@ public:
 	bool multithreading() const { return bool_value(SDLOPTION_MULTITHREADING); }
 	const char *numprocessors() const { return value(SDLOPTION_NUMPROCESSORS); }
 	bool video_fps() const { return bool_value(SDLOPTION_SDLVIDEOFPS); }
-	int bench() const { return int_value(SDLOPTION_BENCH); }
 
 	// video options
 	const char *video() const { return value(SDLOPTION_VIDEO); }
@@ -250,6 +248,7 @@ public:
 	// audio overridables
 	virtual void update_audio_stream(const INT16 *buffer, int samples_this_frame);
 	virtual void set_mastervolume(int attenuation);
+	virtual bool get_audio_status(osd_audio_status &status);
 
 	// input overridables
 	virtual void customize_input_type_list(simple_list<input_type_entry> &typelist);
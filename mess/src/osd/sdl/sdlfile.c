@@ -160,6 +160,21 @@ file_error osd_open(const char *path, UINT32 openflags, osd_file **file, UINT64
 		goto error;
 	}
 
+	#ifdef SDLMAME_EMSCRIPTEN
+	// read-only opens of fetched assets don't touch the filesystem at all
+	if (!(openflags & OPEN_FLAG_WRITE))
+	{
+		int assetsize = jsmess_asset_size((*file)->filename);
+		if (assetsize >= 0)
+		{
+			(*file)->type = SDLFILE_ASSET;
+			(*file)->handle = -1;
+			*filesize = (UINT64)assetsize;
+			goto error;
+		}
+	}
+	#endif
+
 	tmpstr = (char *) osd_malloc_array(strlen((*file)->filename)+1);
 	strcpy(tmpstr, (*file)->filename);
 
@@ -324,6 +339,19 @@ file_error osd_read(osd_file *file, void *buffer, UINT64 offset, UINT32 count, U
          return sdl_read_ptty(file, buffer, offset, count, actual);
          break;
 
+#ifdef SDLMAME_EMSCRIPTEN
+      case SDLFILE_ASSET:
+         result = jsmess_asset_read(file->filename, buffer, (UINT32)offset&0xffffffff, count);
+         if (result < 0)
+            return FILERR_FAILURE;
+
+         if (actual != NULL)
+            *actual = result;
+
+         return FILERR_NONE;
+         break;
+#endif
+
       default:
          return FILERR_FAILURE;
     }
@@ -398,6 +426,11 @@ file_error osd_close(osd_file *file)
          return sdl_close_ptty(file);
          break;
 
+      case SDLFILE_ASSET:
+         osd_free(file);
+         return FILERR_NONE;
+         break;
+
       default:
          return FILERR_FAILURE;
     }
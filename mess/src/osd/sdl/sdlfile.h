@@ -19,7 +19,8 @@ enum
 {
 	SDLFILE_FILE = 0,
 	SDLFILE_SOCKET,
-	SDLFILE_PTTY
+	SDLFILE_PTTY,
+	SDLFILE_ASSET
 };
 
 //============================================================
@@ -49,3 +50,11 @@ file_error sdl_write_ptty(osd_file *file, const void *buffer, UINT64 offset, UIN
 file_error sdl_close_ptty(osd_file *file);
 
 file_error error_to_file_error(UINT32 error);
+
+#ifdef SDLMAME_EMSCRIPTEN
+// implemented in JavaScript (templates/default/post.js); assets are the BIOS
+// and software files fetched by the page loader, read straight from the
+// downloaded data rather than from copies in the Emscripten filesystem
+extern "C" int jsmess_asset_size(const char *path);
+extern "C" int jsmess_asset_read(const char *path, void *buffer, UINT32 offset, UINT32 count);
+#endif
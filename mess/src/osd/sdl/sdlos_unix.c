@@ -21,6 +21,9 @@
 
 // MAME headers
 #include "osdcore.h"
+#ifdef SDLMAME_EMSCRIPTEN
+#include "sdlfile.h"
+#endif
 
 
 
@@ -266,6 +269,22 @@ osd_directory_entry *osd_stat(const char *path)
 	err = stat64(path, &st);
 	#endif
 
+	#ifdef SDLMAME_EMSCRIPTEN
+	// assets fetched by the page loader only exist on the JavaScript side
+	if (err == -1)
+	{
+		int assetsize = jsmess_asset_size(path);
+		if (assetsize < 0) return NULL;
+
+		result = (osd_directory_entry *) osd_malloc_array(sizeof(*result) + strlen(path) + 1);
+		strcpy(((char *) result) + sizeof(*result), path);
+		result->name = ((char *) result) + sizeof(*result);
+		result->type = ENTTYPE_FILE;
+		result->size = (UINT64)assetsize;
+		return result;
+	}
+	#endif
+
 	if( err == -1) return NULL;
 
 	// create an osd_directory_entry; be sure to make sure that the caller can
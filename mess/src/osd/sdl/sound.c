@@ -33,12 +33,16 @@
 #define SDL_XFER_SAMPLES	(512)
 
 static int sdl_xfer_samples = SDL_XFER_SAMPLES;
-static int stream_in_initialized = 0;
-static int stream_loop = 0;
 
 // maximum audio latency
 #define MAX_AUDIO_LATENCY		5
 
+// each step of audio_latency keeps this many milliseconds of sound queued
+#define AUDIO_LATENCY_MSEC		100
+
+// bytes in one stereo sample frame
+#define FRAME_BYTES				(2 * sizeof(INT16))
+
 //============================================================
 //  LOCAL VARIABLES
 //============================================================
@@ -46,17 +50,23 @@ static int stream_loop = 0;
 static int				attenuation = 0;
 
 static int				initialized_audio = 0;
-static int				buf_locked;
 
+// the stream buffer is a single-producer/single-consumer ring: only
+// update_audio_stream advances stream_written and only sdl_callback
+// advances stream_played, so neither side ever needs the audio lock;
+// both count bytes ever transferred, and the ring size is a power of two
+// so that they can simply wrap
 static INT8				*stream_buffer;
-static volatile INT32	stream_playpos;
-
 static UINT32			stream_buffer_size;
-static UINT32			stream_buffer_in;
+static volatile INT32	stream_written;
+static volatile INT32	stream_played;
+static volatile INT32	stream_played_frames;
+static UINT32			stream_target;
+static int				stream_started;
 
 // buffer over/underflow counts
-static int				buffer_underflows;
-static int				buffer_overflows;
+static volatile INT32	buffer_underflows;
+static volatile INT32	buffer_overflows;
 
 // debugging
 static FILE *sound_log;
@@ -128,213 +138,119 @@ static void sdl_cleanup_audio(running_machine &machine)
 }
 
 //============================================================
-//  lock_buffer
+//  Apply attenuation
 //============================================================
-static int lock_buffer(running_machine &machine, long offset, long size, void **buffer1, long *length1, void **buffer2, long *length2)
-{
-	volatile long pstart, pend, lstart, lend;
 
-	if (!buf_locked)
-	{
-		if (machine.video().throttled())
-		{
-			pstart = stream_playpos;
-			pend = (pstart + sdl_xfer_samples);
-			lstart = offset;
-			lend = lstart+size;
-			while (((pstart >= lstart) && (pstart <= lend)) ||
-			       ((pend >= lstart) && (pend <= lend)))
-			{
-				pstart = stream_playpos;
-				pend = pstart + sdl_xfer_samples;
-			}
-		}
-
-		SDL_LockAudio();
-		buf_locked++;
-	}
-
-	// init lengths
-	*length1 = *length2 = 0;
-
-	if ((offset + size) > stream_buffer_size)
-	{
-		// 2-piece case
-		*length1 = stream_buffer_size - offset;
-		*buffer1 = &stream_buffer[offset];
-		*length2 = size - *length1;
-		*buffer2 = stream_buffer;
-	}
-	else
+static void att_memcpy(void *dest, const INT16 *data, int bytes_to_copy)
+{
+	int level= (int) (pow(10.0, (float) attenuation / 20.0) * 128.0);
+	INT16 *d = (INT16 *) dest;
+	int count = bytes_to_copy/2;
+	while (count>0)
 	{
-		// normal 1-piece case
-		*length1 = size;
-		*buffer1 = &stream_buffer[offset];
+		*d++ = (*data++ * level) >> 7; /* / 128 */
+		count--;
 	}
-
-	if (LOG_SOUND)
-		fprintf(sound_log, "locking %ld bytes at offset %ld (total %d, playpos %d): len1 %ld len2 %ld\n",
-	        size, offset, stream_buffer_size, stream_playpos, *length1, *length2);
-
-	return 0;
 }
 
 //============================================================
-//  unlock_buffer
+//  stream_load - read a ring index; it is a full
+//  barrier, so the ring data it covers is only
+//  touched after the index has been seen
 //============================================================
-static void unlock_buffer(void)
+
+INLINE UINT32 stream_load(volatile INT32 *index)
 {
-	buf_locked--;
-	if (!buf_locked)
-		SDL_UnlockAudio();
+#ifdef __GNUC__
+	// atomic_add32 is a plain add on hosts without an eminline version (ARM)
+	return (UINT32)__sync_fetch_and_add(index, 0);
+#else
+	return (UINT32)atomic_add32(index, 0);
+#endif
+}
 
-	if (LOG_SOUND)
-		fprintf(sound_log, "unlocking\n");
+//============================================================
+//  stream_advance - publish a ring index once the
+//  ring data it covers has been written or read
+//============================================================
 
+INLINE void stream_advance(volatile INT32 *index, UINT32 bytes)
+{
+#ifdef __GNUC__
+	__sync_fetch_and_add(index, (INT32)bytes);
+#else
+	atomic_add32(index, (INT32)bytes);
+#endif
 }
 
 //============================================================
-//  Apply attenuation
+//  stream_buffered - number of bytes queued and not
+//  yet played
 //============================================================
 
-static void att_memcpy(void *dest, const INT16 *data, int bytes_to_copy)
+INLINE UINT32 stream_buffered(void)
 {
-	int level= (int) (pow(10.0, (float) attenuation / 20.0) * 128.0);
-	INT16 *d = (INT16 *) dest;
-	int count = bytes_to_copy/2;
-	while (count>0)
-	{
-		*d++ = (*data++ * level) >> 7; /* / 128 */
-		count--;
-	}
+	return stream_load(&stream_written) - stream_load(&stream_played);
 }
 
 //============================================================
-//  copy_sample_data
+//  update_audio_stream
 //============================================================
 
-static void copy_sample_data(running_machine &machine, const INT16 *data, int bytes_to_copy)
+void sdl_osd_interface::update_audio_stream(const INT16 *buffer, int samples_this_frame)
 {
-	void *buffer1, *buffer2 = (void *)NULL;
-	long length1, length2;
-	int cur_bytes;
-
-	// attempt to lock the stream buffer
-	if (lock_buffer(machine, stream_buffer_in, bytes_to_copy, &buffer1, &length1, &buffer2, &length2) < 0)
-	{
-		buffer_underflows++;
+	// if nothing to do, don't do it
+	if (machine().sample_rate() == 0 || stream_buffer == NULL)
 		return;
-	}
 
-	// adjust the input pointer
-	stream_buffer_in += bytes_to_copy;
-	if (stream_buffer_in >= stream_buffer_size)
-	{
-		stream_buffer_in -= stream_buffer_size;
-		stream_loop = 1;
+	UINT32 bytes_this_frame = samples_this_frame * FRAME_BYTES;
+	UINT32 space = stream_buffer_size - stream_buffered();
 
+	// if the ring is full, keep what fits and drop the rest
+	if (bytes_this_frame > space)
+	{
 		if (LOG_SOUND)
-			fprintf(sound_log, "stream_loop set to 1 (stream_buffer_in looped)\n");
+			fprintf(sound_log, "Overflow: written=%d played=%d bytes=%d space=%d\n", (int)stream_written, (int)stream_played, (int)bytes_this_frame, (int)space);
+
+		atomic_increment32(&buffer_overflows);
+		bytes_this_frame = space;
 	}
 
-	// copy the first chunk
-	cur_bytes = (bytes_to_copy > length1) ? length1 : bytes_to_copy;
-	att_memcpy(buffer1, data, cur_bytes);
+	// copy in up to two pieces around the end of the ring
+	UINT32 offset = stream_written & (stream_buffer_size - 1);
+	UINT32 first = MIN(bytes_this_frame, stream_buffer_size - offset);
+	att_memcpy(stream_buffer + offset, buffer, first);
+	if (first < bytes_this_frame)
+		att_memcpy(stream_buffer, buffer + first / sizeof(INT16), bytes_this_frame - first);
 
-	// adjust for the number of bytes
-	bytes_to_copy -= cur_bytes;
-	data = (INT16 *)((UINT8 *)data + cur_bytes);
+	// publish the new data to the callback only once it is all in place
+	stream_advance(&stream_written, bytes_this_frame);
 
-	// copy the second chunk
-	if (bytes_to_copy != 0)
+	// hold off playing until we have the target latency queued
+	if (!stream_started && stream_buffered() >= stream_target)
 	{
-		cur_bytes = (bytes_to_copy > length2) ? length2 : bytes_to_copy;
-		att_memcpy(buffer2, data, cur_bytes);
+		stream_started = 1;
+		SDL_PauseAudio(0);
 	}
-
-	// unlock
-	unlock_buffer();
 }
 
 
+
 //============================================================
-//  update_audio_stream
+//  get_audio_status
 //============================================================
 
-void sdl_osd_interface::update_audio_stream(const INT16 *buffer, int samples_this_frame)
+bool sdl_osd_interface::get_audio_status(osd_audio_status &status)
 {
-	// if nothing to do, don't do it
-	if (machine().sample_rate() != 0 && stream_buffer)
-	{
-		int bytes_this_frame = samples_this_frame * sizeof(INT16) * 2;
-		int play_position, write_position, stream_in;
-		int orig_write; // used in LOG
-
-		play_position = stream_playpos;
-
-		write_position = stream_playpos + ((machine().sample_rate() / 50) * sizeof(INT16) * 2);
-		orig_write = write_position;
-
-		if (!stream_in_initialized)
-		{
-			stream_in = stream_buffer_in = (write_position + stream_buffer_size) / 2;
-
-			if (LOG_SOUND)
-			{
-				fprintf(sound_log, "stream_in = %d\n", (int)stream_in);
-				fprintf(sound_log, "stream_playpos = %d\n", (int)stream_playpos);
-				fprintf(sound_log, "write_position = %d\n", (int)write_position);
-			}
-			// start playing
-			SDL_PauseAudio(0);
-
-			stream_in_initialized = 1;
-		}
-		else
-		{
-			// normalize the stream in position
-			stream_in = stream_buffer_in;
-			if (stream_in < write_position && stream_loop == 1)
-				stream_in += stream_buffer_size;
-
-			// now we should have, in order:
-			//    <------pp---wp---si--------------->
-
-			// if we're between play and write positions, then bump forward, but only in full chunks
-			while (stream_in < write_position)
-			{
-				if (LOG_SOUND)
-					fprintf(sound_log, "Underflow: PP=%d  WP=%d(%d)  SI=%d(%d)  BTF=%d\n", (int)play_position, (int)write_position, (int)orig_write, (int)stream_in, (int)stream_buffer_in, (int)bytes_this_frame);
-
-				buffer_underflows++;
-				stream_in += samples_this_frame;
-			}
-
-			// if we're going to overlap the play position, just skip this chunk
-			if (stream_in + bytes_this_frame > play_position + stream_buffer_size)
-			{
-				if (LOG_SOUND)
-					fprintf(sound_log, "Overflow: PP=%d  WP=%d(%d)  SI=%d(%d)  BTF=%d\n", (int)play_position, (int)write_position, (int)orig_write, (int)stream_in, (int)stream_buffer_in, (int)bytes_this_frame);
-
-				buffer_overflows++;
-				return;
-			}
-		}
-
-		if (stream_in >= stream_buffer_size)
-		{
-			stream_in -= stream_buffer_size;
-			stream_loop = 1;
-
-			if (LOG_SOUND)
-				fprintf(sound_log, "stream_loop set to 1 (stream_in looped)\n");
-
-		}
-
-		// now we know where to copy; let's do it
-		stream_buffer_in = stream_in;
-		copy_sample_data(machine(), buffer, bytes_this_frame);
-	}
+	if (machine().sample_rate() == 0 || stream_buffer == NULL)
+		return false;
+
+	status.buffered = stream_buffered() / FRAME_BYTES;
+	status.target = stream_target / FRAME_BYTES;
+	status.consumed = stream_played_frames;
+	status.underruns = buffer_underflows;
+	status.overruns = buffer_overflows;
+	return true;
 }
 
 
@@ -359,60 +275,36 @@ void sdl_osd_interface::set_mastervolume(int _attenuation)
 //============================================================
 static void sdl_callback(void *userdata, Uint8 *stream, int len)
 {
-	int len1, len2, sb_in;
-
-	sb_in = stream_buffer_in;
-	if (stream_loop)
-		sb_in += stream_buffer_size;
+	UINT32 available = stream_buffered();
+	UINT32 bytes = MIN((UINT32)len, available);
 
-	if (sb_in < (stream_playpos+len))
+	// running dry is an underflow; play what we have and pad with silence
+	if (bytes < (UINT32)len)
 	{
 		if (LOG_SOUND)
-			fprintf(sound_log, "Underflow at sdl_callback: SPP=%d SBI=%d(%d) Len=%d\n", (int)stream_playpos, (int)sb_in, (int)stream_buffer_in, (int)len);
+			fprintf(sound_log, "Underflow at sdl_callback: written=%d played=%d len=%d\n", (int)stream_written, (int)stream_played, len);
 
-		return;
-	}
-	else if ((stream_playpos+len) > stream_buffer_size)
-	{
-		len1 = stream_buffer_size - stream_playpos;
-		len2 = len - len1;
-	}
-	else
-	{
-		len1 = len;
-		len2 = 0;
+		atomic_increment32(&buffer_underflows);
+		memset(stream + bytes, 0, len - bytes);
 	}
 
+	// copy out in up to two pieces around the end of the ring
+	UINT32 offset = stream_played & (stream_buffer_size - 1);
+	UINT32 first = MIN(bytes, stream_buffer_size - offset);
 	if (snd_enabled)
 	{
-		memcpy(stream, stream_buffer + stream_playpos, len1);
-		memset(stream_buffer + stream_playpos, 0, len1); // no longer needed
-		if (len2)
-		{
-			memcpy(stream+len1, stream_buffer, len2);
-			memset(stream_buffer, 0, len2); // no longer needed
-		}
-
+		memcpy(stream, stream_buffer + offset, first);
+		memcpy(stream + first, stream_buffer, bytes - first);
 	}
 	else
-	{
-		memset(stream, 0, len);
-	}
+		memset(stream, 0, bytes);
 
-	// move the play cursor
-	stream_playpos += len1 + len2;
-	if (stream_playpos >= stream_buffer_size)
-	{
-		stream_playpos -= stream_buffer_size;
-		stream_loop = 0;
-
-		if (LOG_SOUND)
-			fprintf(sound_log, "stream_loop set to 0 (stream_playpos looped)\n");
-	}
+	// hand the space back to update_audio_stream
+	stream_advance(&stream_played, bytes);
+	atomic_add32(&stream_played_frames, bytes / FRAME_BYTES);
 
 	if (LOG_SOUND)
-		fprintf(sound_log, "callback: xfer len1 %d len2 %d, playpos %d\n",
-				len1, len2, stream_playpos);
+		fprintf(sound_log, "callback: xfer %d of %d, buffered %d\n", (int)bytes, len, (int)stream_buffered());
 }
 
 
@@ -442,8 +334,7 @@ static int sdl_init(running_machine &machine)
 	initialized_audio = 0;
 
 	sdl_xfer_samples = SDL_XFER_SAMPLES;
-	stream_in_initialized = 0;
-	stream_loop = 0;
+	stream_started = 0;
 
 	// set up the audio specs
 	aspec.freq = machine.sample_rate();
@@ -482,11 +373,11 @@ static int sdl_init(running_machine &machine)
 		audio_latency = 1;
 	}
 
-	// compute the buffer sizes
-	stream_buffer_size = machine.sample_rate() * 2 * sizeof(INT16) * audio_latency / MAX_AUDIO_LATENCY;
-	stream_buffer_size = (stream_buffer_size / 1024) * 1024;
-	if (stream_buffer_size < 1024)
-		stream_buffer_size = 1024;
+	// aim to keep the requested latency queued, never less than two callbacks'
+	// worth; the ring holds twice that so bursty frames have room
+	stream_target = (UINT64)machine.sample_rate() * audio_latency * AUDIO_LATENCY_MSEC / 1000 * FRAME_BYTES;
+	stream_target = MAX(stream_target, 2 * sdl_xfer_samples * FRAME_BYTES);
+	for (stream_buffer_size = 1024; stream_buffer_size < 2 * stream_target; stream_buffer_size *= 2) ;
 
 	// create the buffers
 	if (sdl_create_buffers())
@@ -530,8 +421,9 @@ static int sdl_create_buffers(void)
 	mame_printf_verbose("sdl_create_buffers: creating stream buffer of %u bytes\n", stream_buffer_size);
 
 	stream_buffer = global_alloc_array_clear(INT8, stream_buffer_size);
-	stream_playpos = 0;
-	buf_locked = 0;
+	stream_written = 0;
+	stream_played = 0;
+	stream_played_frames = 0;
 	return 0;
 }
 
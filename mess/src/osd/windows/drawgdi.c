@@ -79,7 +79,7 @@ static render_primitive_list *drawgdi_window_get_primitives(win_window_info *win
 static int drawgdi_window_draw(win_window_info *window, HDC dc, int update);
 
 // rendering
-static void drawgdi_rgb888_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch);
+static void drawgdi_rgb888_draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, const rectangle *clip);
 
 
 
@@ -216,7 +216,7 @@ static int drawgdi_window_draw(win_window_info *window, HDC dc, int update)
 
 	// draw the primitives to the bitmap
 	window->primlist->acquire_lock();
-	drawgdi_rgb888_draw_primitives(*window->primlist, gdi->bmdata, width, height, pitch);
+	drawgdi_rgb888_draw_primitives(*window->primlist, gdi->bmdata, width, height, pitch, NULL);
 	window->primlist->release_lock();
 
 	// fill in bitmap-specific info
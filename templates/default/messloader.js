@@ -1,15 +1,33 @@
 var gamename = 'GAME_FILE';
-var game_file = null;
 var bios_filenames = 'BIOS_FILES'.split(' ');
-var bios_files = {};
-var file_countdown = 0;
-if (bios_filenames.length !== 0 && bios_filenames[0] !== '') {
-  file_countdown += bios_filenames.length;
+
+// Assets (the BIOS files and the game) are kept here as they were
+// downloaded; osd_open/osd_read in the emulator read them on demand through
+// the functions in post.js instead of from copies in the Emscripten
+// filesystem.
+var JSMESS = JSMESS || {};
+JSMESS.assets = {};
+
+var asset_names = [];
+for (var i = 0; i < bios_filenames.length; i++) {
+	if (bios_filenames[i] !== '') {
+		asset_names.push(bios_filenames[i]);
+	}
 }
 if (gamename !== '' && gamename !== 'GAME_FILE') {
-  file_countdown++;
+	asset_names.push(gamename);
 }
 
+// everything we wait for before starting: each asset plus the emulator
+var pending = asset_names.length + 1;
+
+// set once any download fails; nothing is started after that
+var startup_failed = false;
+var requests = [];
+
+// a download that makes no progress for this long is given up on
+var stall_timeout_ms = 30000;
+
 var newCanvas = document.createElement('canvas');
 newCanvas.id = 'canvas';
 newCanvas.width = 256;
@@ -17,14 +35,85 @@ newCanvas.height = 256;
 var holder = document.getElementById('canvasholder');
 holder.appendChild(newCanvas);
 
+// One status line per download, updated as it progresses.
+var progress_line = function(name) {
+	var line = document.createElement('div');
+	document.getElementById('status').appendChild(line);
+	return function(text) {
+		line.innerHTML = name + ': ' + text;
+	};
+};
+
+var start_when_ready = function() {
+	if (startup_failed) {
+		return;
+	}
+	pending -= 1;
+	if (pending === 0) {
+		Module['run']();
+	}
+};
+
+// Stop the start-up sequence: say which file broke it and drop the other
+// downloads, since the emulator can't run without all of them.
+var fail_startup = function(name, reason) {
+	if (startup_failed) {
+		return;
+	}
+	startup_failed = true;
+	for (var i = 0; i < requests.length; i++) {
+		requests[i].abort();
+	}
+	var line = document.createElement('div');
+	line.style.color = 'red';
+	line.innerHTML = 'Unable to start: ' + name + ' ' + reason + '.';
+	document.getElementById('status').appendChild(line);
+};
+
 var fetch_file = function(url, cb) {
+	var progress = progress_line(url);
 	var xhr = new XMLHttpRequest();
+	var stall_timer = null;
+	var fail = function(reason) {
+		clearTimeout(stall_timer);
+		progress('failed (' + reason + ')');
+		fail_startup(url, reason);
+	};
+	var watch_stall = function() {
+		clearTimeout(stall_timer);
+		stall_timer = setTimeout(function() {
+			xhr.abort();
+			fail('no data for ' + (stall_timeout_ms / 1000) + ' seconds');
+		}, stall_timeout_ms);
+	};
 	xhr.open("GET", url, true);
 	xhr.responseType = "arraybuffer";
+	xhr.onprogress = function(e) {
+		watch_stall();
+		if (e.lengthComputable) {
+			progress(Math.floor(100 * e.loaded / e.total) + '%');
+		} else {
+			progress(Math.floor(e.loaded / 1024) + ' KB');
+		}
+	};
 	xhr.onload = function(e) {
-		var ints = new Int8Array(xhr.response);
-		cb(ints);
+		if (xhr.status !== 200 && xhr.status !== 0) {
+			fail('HTTP ' + xhr.status);
+			return;
+		}
+		clearTimeout(stall_timer);
+		progress('done');
+		cb(new Uint8Array(xhr.response));
+	};
+	xhr.onerror = function(e) {
+		fail('network error');
+	};
+	xhr.onabort = function(e) {
+		clearTimeout(stall_timer);
 	};
+	progress('0%');
+	requests.push(xhr);
+	watch_stall();
 	xhr.send();
 };
 
@@ -41,40 +130,34 @@ var Module = {
 		};
 	})(),
 	canvas: document.getElementById('canvas'),
-	noInitialRun: false,
-	preInit: function() {
-		// Load the downloaded binary files into the filesystem.
-		for (var bios_fname in bios_files) {
-			if (bios_files.hasOwnProperty(bios_fname)) {
-				Module['FS_createDataFile']('/', bios_fname, bios_files[bios_fname], true, true);
-			}
-		}
-		if (gamename !== "" && gamename !== "GAME_FILE") {
-			Module['FS_createDataFile']('/', gamename, game_file, true, true);
-		}
-	}
-};
-
-var update_countdown = function() {
-  file_countdown -= 1;
-  if (file_countdown === 0) {
-    var headID = document.getElementsByTagName("head")[0];
-		var newScript = document.createElement('script');
-		newScript.type = 'text/javascript';
-		newScript.src = 'MESS_SRC';
-		headID.appendChild(newScript);
-  }
+	// started by start_when_ready once the assets have arrived too
+	noInitialRun: true
 };
 
-// Fetch the BIOS and the game we want to run.
-for (var i=0; i < bios_filenames.length; i++) {
-  var fname = bios_filenames[i];
-  if (fname === "") {
-    continue;
-  }
-  fetch_file(fname, function(data) { bios_files[fname] = data; update_countdown(); });
-}
+// Fetch the emulator, the BIOS and the game we want to run all at once.
+(function() {
+	var progress = progress_line('MESS_SRC');
+	var headID = document.getElementsByTagName("head")[0];
+	var newScript = document.createElement('script');
+	newScript.type = 'text/javascript';
+	newScript.src = 'MESS_SRC';
+	newScript.onload = function() {
+		progress('done');
+		start_when_ready();
+	};
+	newScript.onerror = function() {
+		progress('failed');
+		fail_startup('MESS_SRC', 'could not be loaded');
+	};
+	progress('loading');
+	headID.appendChild(newScript);
+})();
 
-if (gamename !== "" && gamename !== "GAME_FILE") {
-  fetch_file(gamename, function(data) { game_file = data; update_countdown(); });
+for (var i = 0; i < asset_names.length; i++) {
+	(function(fname) {
+		fetch_file(fname, function(data) {
+			JSMESS.assets[fname] = data;
+			start_when_ready();
+		});
+	})(asset_names[i]);
 }
@@ -40,3 +40,47 @@ function _SDL_GL_DestroyWindow() {}
 var JSMESS = JSMESS || {};
 JSMESS.ui_set_show_fps = Module.cwrap('_Z15ui_set_show_fpsi', '', ['number']);
 JSMESS.ui_get_show_fps = Module.cwrap('_Z15ui_get_show_fpsv', 'number');
+
+// Called once the emulator has stopped because the user picked another
+// system; starting a new machine is up to the page, through
+// JSMESS.new_driver(name) if it defines one.
+function _jsmess_new_driver(name) {
+	var driver = Pointer_stringify(name);
+	if (typeof JSMESS.new_driver === 'function') {
+		JSMESS.new_driver(driver);
+	} else {
+		Module.print('Stopped to switch to ' + driver + ', which this page cannot start.');
+	}
+}
+
+// Assets fetched by messloader.js, served to osd_open/osd_stat/osd_read
+// (see sdlfile.c). Names are matched without any leading './' or '/'.
+function jsmess_find_asset(path) {
+	var name = Pointer_stringify(path);
+	while (name.indexOf('./') === 0) {
+		name = name.substr(2);
+	}
+	while (name.charAt(0) === '/') {
+		name = name.substr(1);
+	}
+	var assets = JSMESS.assets || {};
+	return assets.hasOwnProperty(name) ? assets[name] : null;
+}
+function _jsmess_asset_size(path) {
+	var asset = jsmess_find_asset(path);
+	return asset ? asset.length : -1;
+}
+function _jsmess_asset_read(path, buffer, offset, count) {
+	var asset = jsmess_find_asset(path);
+	if (!asset) {
+		return -1;
+	}
+	offset = offset >>> 0;
+	count = count >>> 0;
+	if (offset >= asset.length) {
+		return 0;
+	}
+	var end = Math.min(offset + count, asset.length);
+	HEAPU8.set(asset.subarray(offset, end), buffer);
+	return end - offset;
+}